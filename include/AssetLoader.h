@@ -0,0 +1,370 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class TextureRef;
+
+/**
+ * @struct TextureRegion
+ * @brief Lo que hay que pasar a SDL_RenderTexture para dibujar un handle
+ */
+struct TextureRegion
+{
+    SDL_Texture *texture = nullptr; ///< Textura (o página de atlas); nullptr = no dibujar
+    SDL_FRect source{};             ///< Rectángulo dentro de la textura (si hasSource)
+    bool hasSource = false;         ///< false = textura completa
+
+    /**
+     * @brief Rectángulo origen para SDL_RenderTexture (nullptr = textura completa)
+     */
+    const SDL_FRect *Source() const { return hasSource ? &source : nullptr; }
+};
+
+/**
+ * @struct TextureHandle
+ * @brief Identifica una textura pedida a AssetLoader (id 0 = inválido).
+ *
+ * Es lo que guardan SpriteComponent y RenderSnapshot: se resuelve a SDL_Texture
+ * solo al dibujar, así una textura aún no subida se dibuja como placeholder.
+ */
+struct TextureHandle
+{
+    uint32_t id = 0;
+
+    bool IsValid() const { return id != 0; }
+};
+
+/**
+ * @class AssetLoader
+ * @brief Carga asíncrona de texturas: decodifica en hilos propios y sube a GPU por frame.
+ *
+ * Responsabilidades:
+ * - RequestTexture (cualquier hilo): devuelve un handle al instante; una ruta ya
+ *   pedida devuelve el mismo handle (cada archivo se decodifica una sola vez)
+ * - Hilos de decodificación: IMG_Load a SDL_Surface (no toca el renderer)
+ * - ProcessUploads (hilo principal): SDL_CreateTextureFromSurface con un máximo de
+ *   subidas por frame, para repartir el coste de una oleada nueva en varios frames
+ * - Resolve (hilo principal): textura lista, placeholder si está pendiente,
+ *   nullptr si falló
+ * - Wait / WaitForAll: bloquear hasta que una textura (o todas) esté lista;
+ *   en el hilo principal sube en el acto en lugar de esperar al siguiente frame
+ *
+ * Sin renderer (servidor headless):
+ * - No arranca hilos ni lee archivos; los handles siguen siendo válidos y
+ *   deduplicados, pero Resolve() devuelve nullptr
+ *
+ * Renderer diferido (arranque):
+ * - Se decodifica desde el principio mientras SDL crea la ventana y el renderer;
+ *   las subidas esperan a AttachRenderer()
+ *
+ * Atlas de sprites (ConfigureAtlas / RequestAtlasSprite / BuildAtlas):
+ * - Los sprites pedidos con RequestAtlasSprite se decodifican igual, pero no se
+ *   suben por separado: BuildAtlas los empaqueta (AtlasPacker) en pocas páginas
+ *   y cada handle pasa a ser página + rectángulo (ResolveRegion)
+ * - Dibujar jugador, enemigos y obstáculos ya casi no cambia de textura
+ * - Lo pedido después de BuildAtlas (o que no cabe en una página) va suelto
+ *
+ * Referencias (TextureRef):
+ * - Cada ruta se decodifica una vez y la comparten todas las entidades que la usan;
+ *   la memoria crece con los archivos distintos, no con el número de entidades
+ * - Acquire devuelve un TextureRef que cuenta referencias (SpriteComponent, fondo)
+ * - Con un periodo de gracia >= 0 (SetUnusedGrace), ProcessUploads libera las
+ *   texturas que llevan ese tiempo sin referencias; si se vuelven a pedir, se
+ *   decodifican otra vez. Por defecto (-1) nunca se liberan antes del final
+ * - El periodo empieza al soltar la última referencia: una textura pedida y aún
+ *   no adquirida (p. ej. precargada con RequestTexture) no se libera
+ *
+ * Ciclo de vida:
+ * - Las texturas pertenecen al loader y viven hasta su destrucción (o su liberación)
+ * - Destruir antes que el renderer y después de todo TextureRef
+ *
+ * Estados: DECODING → DECODED → READY (o FAILED); READY → EVICTED → DECODING
+ * (las entradas de atlas no se liberan: comparten la página)
+ */
+class AssetLoader
+{
+public:
+    // ===== CONSTRUCTOR & DESTRUCTOR =====
+    /**
+     * @brief Crea el placeholder y arranca los hilos de decodificación (hilo principal)
+     * @param renderer Renderer para subir texturas (nullptr = headless, no carga nada)
+     * @param decodeThreads Hilos de decodificación (mínimo 1)
+     * @param maxUploadsPerFrame Subidas por ProcessUploads() (<= 0 = sin límite)
+     */
+    AssetLoader(SDL_Renderer *renderer, size_t decodeThreads, int maxUploadsPerFrame);
+
+    /**
+     * @brief Arranca los hilos de decodificación sin renderer todavía (hilo principal)
+     *
+     * Las texturas pedidas se decodifican ya; ninguna se sube hasta AttachRenderer().
+     *
+     * @param decodeThreads Hilos de decodificación (mínimo 1)
+     * @param maxUploadsPerFrame Subidas por ProcessUploads() (<= 0 = sin límite)
+     */
+    AssetLoader(size_t decodeThreads, int maxUploadsPerFrame);
+
+    /**
+     * @brief Detiene los hilos y libera superficies y texturas (hilo principal)
+     */
+    ~AssetLoader();
+
+    AssetLoader(const AssetLoader &) = delete;
+    AssetLoader &operator=(const AssetLoader &) = delete;
+
+    // ===== PETICIONES (cualquier hilo) =====
+    /**
+     * @brief Pide una textura; la decodificación empieza en segundo plano
+     * @param filePath Ruta del archivo (e.g., "assets/sprites/player.png")
+     * @return Handle (inválido si filePath está vacío)
+     */
+    TextureHandle RequestTexture(const std::string &filePath);
+
+    /**
+     * @brief Como RequestTexture, pero devuelve una referencia contada
+     * @param filePath Ruta del archivo
+     * @return Referencia (vacía si filePath está vacío)
+     */
+    TextureRef Acquire(const std::string &filePath);
+
+    /**
+     * @brief Como RequestTexture, pero el sprite irá al atlas si aún no se construyó
+     *
+     * Sin atlas configurado (o ya construido) equivale a RequestTexture.
+     * Si la ruta ya se pidió suelta, se queda suelta.
+     *
+     * @param filePath Ruta del archivo
+     * @return Handle (inválido si filePath está vacío)
+     */
+    TextureHandle RequestAtlasSprite(const std::string &filePath);
+
+    /**
+     * @brief Suma una referencia (lo usa TextureRef)
+     */
+    void AddRef(TextureHandle handle);
+
+    /**
+     * @brief Resta una referencia; en 0 empieza a contar el periodo de gracia (lo usa TextureRef)
+     */
+    void Release(TextureHandle handle);
+
+    /**
+     * @brief ¿La textura ya terminó (subida o fallida)?
+     *
+     * Una textura liberada no cuenta como terminada: se vuelve a pedir.
+     */
+    bool IsDone(TextureHandle handle);
+
+    /**
+     * @brief Espera a que la textura termine (subida o fallida)
+     * @param handle Textura a esperar
+     *
+     * En el hilo principal sube en el acto; en otro hilo espera al ProcessUploads()
+     * del hilo principal (no llamar desde otro hilo si el principal espera a este).
+     */
+    void Wait(TextureHandle handle);
+
+    /**
+     * @brief Espera a todas las texturas pedidas hasta ahora
+     */
+    void WaitForAll();
+
+    /**
+     * @brief Texturas pedidas que aún no terminaron
+     */
+    size_t GetPendingCount() const;
+
+    // ===== HILO PRINCIPAL =====
+    /**
+     * @brief Fija el renderer de un loader creado sin él y crea el placeholder
+     *
+     * Llamar antes de Wait / WaitForAll: sin renderer una subida falla.
+     *
+     * @param renderer Renderer para subir texturas
+     */
+    void AttachRenderer(SDL_Renderer *renderer);
+
+    /**
+     * @brief Segundos sin referencias antes de liberar una textura
+     * @param seconds Periodo de gracia (< 0 = no liberar nunca)
+     */
+    void SetUnusedGrace(float seconds);
+
+    /**
+     * @brief Activa el atlas de sprites (antes de pedir los sprites)
+     * @param pageSize Lado de cada página en píxeles (<= 0 = sin atlas)
+     */
+    void ConfigureAtlas(int pageSize);
+
+    /**
+     * @brief Espera a que se decodifiquen los sprites de atlas y los empaqueta en páginas
+     *
+     * Una sola vez; las llamadas siguientes no hacen nada. WaitForAll la llama
+     * en el hilo principal si quedan sprites de atlas pendientes.
+     */
+    void BuildAtlas();
+
+    /**
+     * @brief Sube a GPU las texturas ya decodificadas (hasta el límite por frame)
+     *
+     * También libera las texturas sin referencias que agotaron el periodo de gracia
+     * (aquí, en el hilo principal, donde se resuelven: nunca se dibuja una liberada).
+     *
+     * @return Texturas subidas en esta llamada
+     */
+    int ProcessUploads();
+
+    /**
+     * @brief Textura completa de un handle (fondos; un sprite de atlas da su página entera)
+     * @return Textura lista, placeholder si está pendiente, nullptr si falló, fue liberada o es inválido
+     */
+    SDL_Texture *Resolve(TextureHandle handle) const;
+
+    /**
+     * @brief Textura y rectángulo origen de un handle (sprites)
+     * @return Como Resolve(); hasSource = true si el handle vive en una página de atlas
+     */
+    TextureRegion ResolveRegion(TextureHandle handle) const;
+
+    /**
+     * @brief ResolveRegion de muchos handles con un solo lock (los sprites de un snapshot)
+     * @param handles Handles a resolver
+     * @param regions Salida: una región por handle, en el mismo orden
+     */
+    void ResolveRegions(const std::vector<TextureHandle> &handles, std::vector<TextureRegion> &regions) const;
+
+private:
+    // ===== ENTRADAS =====
+    enum class State : uint8_t
+    {
+        DECODING,
+        DECODED,
+        READY,
+        FAILED,
+        EVICTED
+    };
+
+    struct Entry
+    {
+        std::string path;
+        State state = State::DECODING;
+        SDL_Surface *surface = nullptr; ///< Resultado de IMG_Load hasta la subida
+        SDL_Texture *texture = nullptr; ///< Textura subida (propiedad del loader)
+        uint32_t refs = 0;              ///< TextureRef vivos
+        Uint64 unusedSinceNs = 0;       ///< SDL_GetTicksNS() cuando refs pasó de 1 a 0
+        bool acquired = false;          ///< Hubo un AddRef desde la última petición
+        bool atlas = false;             ///< Pedido para el atlas (no se sube suelto)
+        bool inAtlas = false;           ///< texture es una página de atlas (no propia)
+        SDL_FRect source{};             ///< Rectángulo dentro de la página
+    };
+
+    SDL_Renderer *m_Renderer;                           ///< Contexto para subir texturas
+    bool m_Headless;                                    ///< Creado con renderer nullptr: no carga nada
+    SDL_Texture *m_Placeholder;                         ///< Se dibuja mientras una textura está pendiente
+    int m_MaxUploadsPerFrame;                           ///< Límite de ProcessUploads() (<= 0 = sin límite)
+    std::deque<Entry> m_Entries;                        ///< Entrada id - 1 (deque: referencias estables)
+    std::unordered_map<std::string, uint32_t> m_ByPath; ///< Ruta → id
+    size_t m_PendingCount;                              ///< Entradas en DECODING o DECODED
+    float m_UnusedGrace;                                ///< Segundos sin referencias antes de liberar (< 0 = nunca)
+
+    // ===== ATLAS =====
+    int m_AtlasPageSize;                     ///< Lado de página (<= 0 = sin atlas)
+    bool m_AtlasBuilt;                       ///< BuildAtlas ya se ejecutó
+    size_t m_AtlasDecoding;                  ///< Sprites de atlas aún en IMG_Load
+    std::vector<SDL_Texture *> m_AtlasPages; ///< Páginas (propiedad del loader)
+
+    // ===== COLAS =====
+    std::deque<uint32_t> m_DecodeQueue; ///< Ids pendientes de IMG_Load
+    std::deque<uint32_t> m_UploadQueue; ///< Ids decodificados, en orden de llegada
+
+    // ===== SINCRONIZACIÓN =====
+    mutable std::mutex m_Mutex;           ///< Protege entradas y colas
+    std::condition_variable m_DecodeWork; ///< Despierta a los hilos de decodificación
+    std::condition_variable m_Progress;   ///< Una entrada cambió de estado (para Wait)
+    bool m_Stop;                          ///< Pide a los hilos que terminen
+    std::vector<std::thread> m_Threads;   ///< Hilos de decodificación
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief RequestTexture / RequestAtlasSprite (cualquier hilo)
+     * @param atlas ¿Reservar el sprite para el atlas?
+     */
+    TextureHandle Request(const std::string &filePath, bool atlas);
+
+    /**
+     * @brief Bucle de un hilo de decodificación
+     */
+    void DecodeLoop();
+
+    /**
+     * @brief Arranca los hilos de decodificación (constructores)
+     */
+    void StartThreads(size_t decodeThreads);
+
+    /**
+     * @brief Sube una entrada DECODED (hilo principal; lock tomado, se libera durante la subida)
+     */
+    void Upload(uint32_t id, std::unique_lock<std::mutex> &lock);
+
+    /**
+     * @brief Región de una entrada (lock tomado)
+     */
+    TextureRegion RegionOf(uint32_t id) const;
+
+    /**
+     * @brief Vuelve a encolar una entrada EVICTED para decodificarla (lock tomado)
+     */
+    void Redecode(uint32_t id);
+
+    /**
+     * @brief Crea la textura placeholder (1x1, blanco translúcido)
+     */
+    void CreatePlaceholder();
+
+    /**
+     * @brief Libera las texturas READY sin referencias durante m_UnusedGrace (lock tomado)
+     */
+    void EvictUnused();
+};
+
+/**
+ * @class TextureRef
+ * @brief Referencia contada a una textura de AssetLoader (RAII).
+ *
+ * Copiar suma una referencia, destruir la resta; mover no toca el contador.
+ * Todo desde cualquier hilo. Get() da el TextureHandle que se copia al snapshot.
+ *
+ * El AssetLoader debe sobrevivir a todas sus referencias.
+ */
+class TextureRef
+{
+public:
+    TextureRef() = default;
+
+    /**
+     * @brief Adopta una referencia ya sumada (la crea AssetLoader::Acquire)
+     */
+    TextureRef(AssetLoader &assets, TextureHandle handle);
+
+    TextureRef(const TextureRef &other);
+    TextureRef(TextureRef &&other) noexcept;
+    TextureRef &operator=(TextureRef other) noexcept;
+    ~TextureRef();
+
+    /**
+     * @brief Handle de la textura (inválido si la referencia está vacía)
+     */
+    TextureHandle Get() const { return m_Handle; }
+
+    bool IsValid() const { return m_Handle.IsValid(); }
+
+private:
+    AssetLoader *m_Assets = nullptr; ///< Loader dueño de la textura
+    TextureHandle m_Handle;          ///< Textura referenciada
+};
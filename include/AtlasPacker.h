@@ -0,0 +1,86 @@
+#pragma once
+#include <vector>
+
+/**
+ * @class AtlasPacker
+ * @brief Empaquetado de rectángulos en páginas cuadradas por estantes (shelf packing).
+ *
+ * Responsabilidades:
+ * - Insert: colocar un rectángulo (con margen) en la primera página donde quepa
+ * - Abrir páginas nuevas cuando la actual se llena
+ * - Recordar el área usada de cada página (la textura final se recorta a ella)
+ *
+ * Algoritmo:
+ * - Cada página es una pila de estantes horizontales; un estante tiene la altura
+ *   del primer rectángulo que lo abrió
+ * - Se elige el estante existente que menos altura desperdicie; si ninguno sirve
+ *   se abre uno nuevo debajo del último
+ * - Insertar de mayor a menor altura deja pocos huecos (lo hace AssetLoader)
+ *
+ * Solo geometría: no toca SDL ni píxeles.
+ *
+ * Usado por:
+ * - AssetLoader::BuildAtlas: sprites de jugador, enemigos y obstáculos
+ */
+class AtlasPacker
+{
+public:
+    /**
+     * @struct Placement
+     * @brief Resultado de Insert (page = -1 si el rectángulo no cabe en una página)
+     */
+    struct Placement
+    {
+        int page = -1;
+        int x = 0;
+        int y = 0;
+    };
+
+    // ===== CONSTRUCTOR =====
+    /**
+     * @param pageSize Lado de cada página en píxeles
+     * @param padding Píxeles vacíos alrededor de cada rectángulo (evita sangrado al filtrar)
+     */
+    AtlasPacker(int pageSize, int padding);
+
+    // ===== EMPAQUETADO =====
+    /**
+     * @brief Coloca un rectángulo
+     * @param width Ancho en píxeles
+     * @param height Alto en píxeles
+     * @return Página y esquina superior izquierda (sin contar el margen)
+     */
+    Placement Insert(int width, int height);
+
+    // ===== CONSULTAS =====
+    int GetPageCount() const { return static_cast<int>(m_Pages.size()); }
+
+    /**
+     * @brief Ancho usado de una página (máximo x + ancho colocado)
+     */
+    int GetUsedWidth(int page) const { return m_Pages[page].usedWidth; }
+
+    /**
+     * @brief Alto usado de una página (fondo del último estante)
+     */
+    int GetUsedHeight(int page) const { return m_Pages[page].usedHeight; }
+
+private:
+    struct Shelf
+    {
+        int y;      ///< Borde superior
+        int height; ///< Alto del estante (con margen)
+        int cursor; ///< Siguiente x libre
+    };
+
+    struct Page
+    {
+        std::vector<Shelf> shelves;
+        int usedWidth = 0;
+        int usedHeight = 0;
+    };
+
+    int m_PageSize;            ///< Lado de página
+    int m_Padding;             ///< Margen por lado
+    std::vector<Page> m_Pages; ///< Páginas abiertas
+};
@@ -0,0 +1,160 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/**
+ * @enum BehaviorAction
+ * @brief Acción que ejecuta un enemigo mientras está en un estado.
+ *
+ * Cada acción tiene su propio bucle en EnemyAISystem (sin virtuales ni switch por enemigo).
+ */
+enum class BehaviorAction : uint8_t
+{
+    Chase,  ///< Perseguir al jugador (FlowField + SteeringKernel)
+    Wander, ///< Deambular con rumbo que gira aleatoriamente
+    Flee,   ///< Alejarse del jugador
+    Orbit,  ///< Girar alrededor del jugador a una distancia fija
+    Dash,   ///< Embestida en línea recta (dirección fijada al entrar al estado)
+    Idle,   ///< Frenar hasta quedarse quieto
+    Count
+};
+
+/**
+ * @enum BehaviorCondition
+ * @brief Condición que dispara una transición.
+ */
+enum class BehaviorCondition : uint8_t
+{
+    PlayerWithin, ///< Distancia al jugador <= value
+    PlayerBeyond, ///< Distancia al jugador > value
+    TimeInState   ///< Tiempo en el estado actual >= value (segundos)
+};
+
+/**
+ * @struct BehaviorState
+ * @brief Estado compilado (fila de la tabla de estados).
+ *
+ * Las transiciones salientes son el rango contiguo
+ * [firstTransition, firstTransition + transitionCount) de la tabla de transiciones.
+ */
+struct BehaviorState
+{
+    BehaviorAction action;
+    float speedScale;         ///< Multiplicador de baseSpeed
+    float radius;             ///< Orbit: distancia al jugador (píxeles)
+    float turnRate;           ///< Wander: giro máximo del rumbo (radianes/segundo)
+    uint16_t firstTransition; ///< Primera transición saliente
+    uint16_t transitionCount; ///< Número de transiciones salientes
+};
+
+/**
+ * @struct BehaviorTransition
+ * @brief Transición compilada (fila de la tabla de transiciones).
+ */
+struct BehaviorTransition
+{
+    BehaviorCondition condition;
+    float value;     ///< Distancia (píxeles) o tiempo (segundos) según condition
+    float valueSq;   ///< value² (las condiciones de distancia comparan distancias al cuadrado)
+    uint16_t target; ///< Estado destino (id global)
+};
+
+/**
+ * @class BehaviorTable
+ * @brief Máquinas de estados de comportamiento de todos los tipos de enemigo.
+ *
+ * Responsabilidades:
+ * - Compilar las definiciones por tipo (sección "behavior" de Enemy_entities.json)
+ *   a dos tablas planas: estados y transiciones
+ * - Resolver nombres a ids enteros al cargar (en runtime solo hay índices)
+ * - Evaluar las transiciones de un estado
+ *
+ * Ids:
+ * - Los estados de todos los tipos comparten un único espacio de ids (uint16_t),
+ *   así EnemyComponent guarda solo su estado actual y no necesita el tipo
+ * - Un tipo sin "behavior" recibe un único estado "chase" sin transiciones
+ *   (comportamiento clásico: persecución dentro de focus_range)
+ *
+ * Ejemplo JSON:
+ *   "behavior": {
+ *     "initial": "wander",
+ *     "states": [
+ *       { "name": "wander", "action": "wander", "speed_scale": 0.4 },
+ *       { "name": "chase",  "action": "chase" }
+ *     ],
+ *     "transitions": [
+ *       { "from": "wander", "to": "chase",  "when": "player_within", "value": 200 },
+ *       { "from": "chase",  "to": "wander", "when": "player_beyond", "value": 260 }
+ *     ]
+ *   }
+ *
+ * Usado por:
+ * - ConfigLoader: Compila cada tipo al cargar Enemy_entities.json
+ * - EnemyAISystem: Evalúa transiciones y agrupa enemigos por acción
+ */
+class BehaviorTable
+{
+public:
+    // ===== DEFINICIONES (tal como vienen del JSON) =====
+    struct StateDef
+    {
+        std::string name;
+        std::string action = "chase";
+        float speedScale = 1.0f;
+        float radius = 150.0f;
+        float turnRate = 2.0f;
+    };
+
+    struct TransitionDef
+    {
+        std::string from;
+        std::string to;
+        std::string when;
+        float value = 0.0f;
+    };
+
+    struct TypeDef
+    {
+        std::string initial;
+        std::vector<StateDef> states;
+        std::vector<TransitionDef> transitions;
+    };
+
+    // ===== COMPILACIÓN =====
+    /**
+     * @brief Compila la máquina de estados de un tipo de enemigo
+     * @param typeName Nombre del tipo (solo para logs)
+     * @param def Definición leída del JSON (vacía = solo "chase")
+     * @return Id global del estado inicial
+     *
+     * Acciones/condiciones desconocidas se registran con spdlog::warn;
+     * la acción cae a "chase" y la transición se descarta.
+     */
+    uint16_t AddType(const std::string &typeName, const TypeDef &def);
+
+    // ===== CONSULTA =====
+    /**
+     * @brief Estado compilado por id global
+     */
+    const BehaviorState &GetState(uint16_t id) const { return m_States[id]; }
+
+    /**
+     * @brief Número total de estados (todos los tipos)
+     */
+    size_t GetStateCount() const { return m_States.size(); }
+
+    /**
+     * @brief Evalúa las transiciones salientes en orden; gana la primera que se cumpla
+     * @param state Estado actual
+     * @param distanceSq Distancia al jugador al cuadrado
+     * @param timeInState Segundos en el estado actual
+     * @return Nuevo estado (o state si ninguna transición se cumple)
+     */
+    uint16_t Evaluate(uint16_t state, float distanceSq, float timeInState) const;
+
+private:
+    // ===== TABLAS =====
+    std::vector<BehaviorState> m_States;           ///< Todos los estados (ids globales)
+    std::vector<BehaviorTransition> m_Transitions; ///< Agrupadas por estado origen
+};
@@ -0,0 +1,121 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <string>
+#include <vector>
+
+class SpriteBatch;
+
+/**
+ * @class BitmapFont
+ * @brief Fuente de mapa de bits: atlas de glifos 5x7 creado una sola vez en una textura.
+ *
+ * Responsabilidades:
+ * - Load: rasterizar la tabla de glifos precocinada (embebida en BitmapFont.cpp)
+ *   en una textura de atlas; no hay TTF ni decodificación por frame
+ * - GetGlyph: coordenadas UV de un carácter dentro del atlas
+ * - Measure: ancho en píxeles de un texto a una escala
+ *
+ * Juego de caracteres:
+ * - Espacio, dígitos, A-Z y % ( ) - . / :
+ * - Las minúsculas se dibujan como mayúsculas; lo demás deja un hueco
+ *
+ * La textura es propiedad de la fuente: destruirla antes que el renderer.
+ */
+class BitmapFont
+{
+public:
+    // ===== MÉTRICAS (píxeles a escala 1) =====
+    static constexpr int GLYPH_WIDTH = 5;  ///< Ancho de un glifo
+    static constexpr int GLYPH_HEIGHT = 7; ///< Alto de un glifo
+    static constexpr int ADVANCE = 6;      ///< Avance horizontal entre caracteres
+
+    // ===== CONSTRUCTOR / DESTRUCTOR =====
+    BitmapFont();
+    ~BitmapFont();
+
+    BitmapFont(const BitmapFont &) = delete;
+    BitmapFont &operator=(const BitmapFont &) = delete;
+
+    // ===== CARGA =====
+    /**
+     * @brief Crea la textura del atlas (hilo principal, una vez)
+     * @param renderer Renderer dueño de la textura
+     * @return true si el atlas se creó
+     */
+    bool Load(SDL_Renderer *renderer);
+
+    // ===== CONSULTAS =====
+    bool IsLoaded() const { return m_Texture != nullptr; }
+    SDL_Texture *GetTexture() const { return m_Texture; }
+
+    /**
+     * @brief UV normalizadas de un carácter
+     * @param c Carácter (minúsculas = mayúsculas)
+     * @param uv Salida: x, y, w, h en [0, 1]
+     * @return false si el carácter no tiene glifo
+     */
+    bool GetGlyph(char c, SDL_FRect &uv) const;
+
+    /**
+     * @brief Ancho en píxeles de un texto de una línea
+     */
+    float Measure(const char *text, float scale) const;
+
+private:
+    SDL_Texture *m_Texture;  ///< Atlas de glifos (blanco sobre transparente)
+    SDL_FRect m_Glyphs[128]; ///< UV por carácter ASCII
+    bool m_HasGlyph[128];    ///< ¿El carácter tiene glifo?
+};
+
+/**
+ * @class TextBlock
+ * @brief Texto de una línea maquetado en un buffer de vértices reutilizable.
+ *
+ * Responsabilidades:
+ * - Set: rehacer la maquetación solo si cambió el texto, la posición, la escala
+ *   o el color (un texto que no cambia entre frames no vuelve a maquetarse)
+ * - Draw: añadir los vértices ya maquetados al SpriteBatch; todos los
+ *   TextBlock de la misma fuente comparten lote (una llamada de dibujo)
+ *
+ * Uso (hilo principal, cada frame):
+ *   block.Set(font, label, x, y, 2.0f, color); // label: char[] reutilizado
+ *   block.Draw(batch, font);
+ */
+class TextBlock
+{
+public:
+    // ===== MAQUETACIÓN =====
+    /**
+     * @brief Asigna el texto (maqueta solo si algo cambió)
+     * @param font Fuente cargada
+     * @param text Texto de una línea
+     * @param x Esquina superior izquierda (píxeles de pantalla)
+     * @param y (ver x)
+     * @param scale Píxeles de pantalla por píxel de glifo
+     * @param color Color del texto
+     * @return true si se rehízo la maquetación
+     */
+    bool Set(const BitmapFont &font, const char *text, float x, float y, float scale, SDL_FColor color);
+
+    // ===== DIBUJO =====
+    /**
+     * @brief Añade el texto al batch (sin maquetar)
+     */
+    void Draw(SpriteBatch &batch, const BitmapFont &font) const;
+
+    // ===== CONSULTAS =====
+    /**
+     * @brief Ancho del texto maquetado en píxeles
+     */
+    float GetWidth() const { return m_Width; }
+
+private:
+    std::string m_Text;                 ///< Texto maquetado
+    float m_X = 0.0f;                   ///< Posición maquetada
+    float m_Y = 0.0f;                   ///< (ver m_X)
+    float m_Scale = 0.0f;               ///< Escala maquetada (0 = nunca maquetado)
+    SDL_FColor m_Color{};               ///< Color maquetado
+    float m_Width = 0.0f;               ///< Ancho en píxeles
+    std::vector<SDL_Vertex> m_Vertices; ///< 4 por glifo visible
+    std::vector<int> m_Indices;         ///< 6 por glifo visible
+};
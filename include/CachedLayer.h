@@ -0,0 +1,85 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+
+class SpriteBatch;
+
+/**
+ * @class CachedLayer
+ * @brief Contenido estático dibujado una vez en una textura render target y reutilizado cada frame.
+ *
+ * Responsabilidades:
+ * - Begin / End: redirigir el SpriteBatch a la textura (SDL_TEXTUREACCESS_TARGET)
+ *   y guardar la clave con la que se generó
+ * - IsValid(clave): el dueño compara la clave de su contenido (versión de
+ *   obstáculos, HP...) en lugar de redibujar
+ * - Invalidate: disparador explícito (p. ej. SDL_EVENT_RENDER_TARGETS_RESET)
+ *
+ * Uso (hilo principal):
+ *   if (!layer.IsValid(key) && layer.Begin(batch, w, h))
+ *   {
+ *       batch.AddRect(...);   // coordenadas locales de la capa
+ *       layer.End(batch, key);
+ *   }
+ *   if (layer.IsValid(key))
+ *       batch.AddSprite(layer.GetTexture(), nullptr, dst); // 1 quad por frame
+ *
+ * La textura es propiedad de la capa: destruirla antes que el renderer.
+ */
+class CachedLayer
+{
+public:
+    // ===== CONSTRUCTOR / DESTRUCTOR =====
+    /**
+     * @param renderer Renderer que crea la textura y dibuja en ella
+     */
+    explicit CachedLayer(SDL_Renderer *renderer);
+    ~CachedLayer();
+
+    CachedLayer(const CachedLayer &) = delete;
+    CachedLayer &operator=(const CachedLayer &) = delete;
+
+    // ===== REGENERACIÓN =====
+    /**
+     * @brief Empieza a dibujar en la capa (vacía y transparente)
+     *
+     * Vacía antes el lote pendiente del batch en el destino anterior. Recrea la
+     * textura si cambió el tamaño.
+     *
+     * @param batch Batch del frame
+     * @param width Ancho de la capa (píxeles)
+     * @param height Alto de la capa (píxeles)
+     * @return false si el renderer no admite render targets (el dueño dibuja sin caché)
+     */
+    bool Begin(SpriteBatch &batch, int width, int height);
+
+    /**
+     * @brief Termina de dibujar en la capa y vuelve al destino por defecto
+     * @param key Clave del contenido dibujado
+     */
+    void End(SpriteBatch &batch, uint64_t key);
+
+    /**
+     * @brief Fuerza a regenerar la capa en el próximo uso
+     */
+    void Invalidate() { m_Valid = false; }
+
+    // ===== CONSULTAS =====
+    /**
+     * @brief ¿La capa contiene el contenido con esta clave?
+     */
+    bool IsValid(uint64_t key) const { return m_Valid && m_Key == key; }
+
+    SDL_Texture *GetTexture() const { return m_Texture; }
+    float GetWidth() const { return static_cast<float>(m_Width); }
+    float GetHeight() const { return static_cast<float>(m_Height); }
+
+private:
+    SDL_Renderer *m_Renderer; ///< Renderer dueño de la textura
+    SDL_Texture *m_Texture;   ///< Render target (nullptr hasta el primer Begin)
+    int m_Width;              ///< Tamaño de m_Texture
+    int m_Height;             ///< (ver m_Width)
+    uint64_t m_Key;           ///< Clave del contenido actual
+    bool m_Valid;             ///< ¿m_Texture contiene m_Key?
+    bool m_Unsupported;       ///< La creación falló: no reintentar cada frame
+};
@@ -0,0 +1,55 @@
+#pragma once
+#include "../Component.h"
+#include "../../external/GLM/include/glm/vec2.hpp"
+
+/**
+ * @class CameraComponent
+ * @brief Vista (viewport) que sigue a su entidad dentro de un mundo mayor que la ventana.
+ *
+ * Responsabilidades:
+ * - Guardar el tamaño de la vista (el de la ventana) y su esquina superior izquierda
+ * - Follow: centrar la vista en la entidad sin salirse del mundo
+ * - Guardar la posición del tick anterior (interpolación, igual que TransformComponent)
+ *
+ * Reglas:
+ * - La vista se limita a [0, mundo - vista] en cada eje
+ * - Si el mundo es menor que la vista en un eje, se centra el mundo en ese eje
+ *
+ * Usado por:
+ * - RenderSystem: actualiza la cámara del jugador al capturar, descarta lo que
+ *   queda fuera de la vista y copia la vista al RenderSnapshot
+ *
+ * Nota: Se añade al jugador en Game::Start (el servidor headless no tiene cámara)
+ */
+class CameraComponent : public Component
+{
+public:
+    // ===== VISTA =====
+    glm::vec2 m_Position;         ///< Esquina superior izquierda de la vista en el mundo (píxeles)
+    glm::vec2 m_PreviousPosition; ///< Posición de la vista en el tick anterior
+    glm::vec2 m_ViewSize;         ///< Tamaño de la vista (píxeles de pantalla)
+
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Inicializa la cámara en el origen del mundo
+     * @param viewWidth Ancho de la vista (ventana)
+     * @param viewHeight Alto de la vista (ventana)
+     */
+    CameraComponent(float viewWidth, float viewHeight);
+
+    // ===== SEGUIMIENTO =====
+    /**
+     * @brief Centra la vista en la entidad (tick anterior y actual)
+     * @param previousCenter Centro de la entidad en el tick anterior
+     * @param center Centro de la entidad en el tick actual
+     * @param worldWidth Ancho del mundo
+     * @param worldHeight Alto del mundo
+     */
+    void Follow(const glm::vec2 &previousCenter, const glm::vec2 &center, float worldWidth, float worldHeight);
+
+private:
+    /**
+     * @brief Esquina de la vista centrada en center y limitada al mundo
+     */
+    glm::vec2 Clamp(const glm::vec2 &center, float worldWidth, float worldHeight) const;
+};
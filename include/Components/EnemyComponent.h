@@ -1,5 +1,7 @@
 #pragma once
 #include "../Component.h"
+#include <glm/glm.hpp>
+#include <cstdint>
 
 /**
  * @class EnemyComponent
@@ -22,6 +24,10 @@
  *
  * Parámetro velocitySmoothing controla qué tan rápido el enemigo
  * cambia su vector de velocidad (Lerp smooth vs salto)
+ *
+ * Comportamiento (máquina de estados de BehaviorTable):
+ * - behaviorState es un id entero global; el tipo ya está implícito en él
+ * - heading guarda el rumbo de Wander o la dirección fijada de Dash
  */
 class EnemyComponent : public Component
 {
@@ -31,14 +37,23 @@ public:
     float focusRange;        ///< Rango de detección/persecución del jugador (píxeles)
     float velocitySmoothing; ///< Factor Lerp para suavizado (0.1-1.0, mayor = cambio más rápido)
 
+    // ===== LOD DE IA =====
+    float aiAccumulatedTime; ///< Tiempo acumulado desde la última actualización de IA (segundos)
+
+    // ===== MÁQUINA DE ESTADOS =====
+    uint16_t behaviorState; ///< Estado actual (id global en BehaviorTable)
+    float stateTime;        ///< Segundos en el estado actual
+    glm::vec2 heading;      ///< Rumbo unitario (Wander) o dirección de embestida (Dash)
+
     // ===== CONSTRUCTOR =====
     /**
      * @brief Inicializa un enemigo con parámetros de IA
      * @param speed Velocidad base de movimiento (ej: 200 px/s)
      * @param range Rango de persecución (ej: 400 píxeles)
      * @param smoothing Factor Lerp de suavizado (ej: 0.5)
+     * @param initialState Estado inicial en BehaviorTable (default 0)
      */
-    EnemyComponent(float speed, float range, float smoothing);
+    EnemyComponent(float speed, float range, float smoothing, uint16_t initialState = 0);
 
     // ===== DESTRUCTOR =====
     ~EnemyComponent() override = default;
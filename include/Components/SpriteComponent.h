@@ -2,8 +2,8 @@
 #include <string>
 #include <iostream>
 #include "../Component.h"
-#include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
+#include "../AssetLoader.h"
+#include "../RenderSnapshot.h"
 #include <spdlog/spdlog.h>
 
 /**
@@ -11,17 +11,18 @@
  * @brief Almacena la textura de renderizado de una entidad.
  *
  * Responsabilidades:
- * - Cargar textura desde archivo (PNG, etc.)
- * - Mantener referencia a SDL_Texture en memoria de GPU
- * - Liberar textura al destruir
+ * - Pedir la textura del archivo (PNG, etc.) a AssetLoader
+ * - Guardar una referencia contada (TextureRef) cuyo handle RenderSystem copia al snapshot
  *
  * Características:
- * - Carga con SDL3_image (IMG_LoadTexture)
- * - Integrado con SDL3 renderer
- * - Loguea errores si la carga falla
+ * - No bloquea: la decodificación ocurre en los hilos de AssetLoader y la subida
+ *   a GPU en el hilo principal; mientras tanto se dibuja un placeholder
+ * - La misma ruta comparte textura entre todas las entidades (la caché es del loader):
+ *   38 obstáculos = 1 decodificación y 1 textura, con 38 referencias
+ * - AssetLoader loguea errores si la carga falla (Resolve devuelve nullptr)
  *
  * Usado por:
- * - RenderSystem: Obtiene m_Texture para renderizar
+ * - RenderSystem: Copia m_Texture.Get() y m_Layer al RenderSnapshot
  * - Todas las entidades visuales (Jugador, Enemigos, Obstáculos)
  *
  * Ruta de Sprites:
@@ -33,29 +34,26 @@
  * - Obstáculo: assets/sprites/obstaculo.png (100x100)
  *
  * Ciclo de vida:
- * 1. Constructor carga la textura con IMG_LoadTexture
- * 2. Se usa en RenderSystem durante todo el juego
- * 3. Destructor libera con SDL_DestroyTexture
+ * 1. Constructor pide la textura (cualquier hilo)
+ * 2. RenderSystem copia el handle al RenderSnapshot de cada frame
+ * 3. El destructor suelta la referencia; la textura la libera AssetLoader
+ *    (al destruirse, o antes si se configuró un periodo de gracia)
  */
 class SpriteComponent : public Component
 {
 public:
     // ===== RENDERIZADO =====
-    SDL_Texture *m_Texture; ///< Textura en memoria de GPU (propiedad del componente)
+    TextureRef m_Texture;                     ///< Referencia a la textura en AssetLoader (se resuelve al dibujar)
+    RenderLayer m_Layer = RenderLayer::WORLD; ///< Capa de dibujo (WORLD = orden Y con el resto de entidades)
 
-    // ===== CONSTRUCTOR & DESTRUCTOR =====
+    // ===== CONSTRUCTOR =====
     /**
-     * @brief Carga una textura desde archivo
+     * @brief Pide una textura desde archivo
      * @param filePath Ruta del archivo (e.g., "assets/sprites/player.png")
-     * @param renderer Contexto SDL3 renderer
+     * @param assets Cargador asíncrono de texturas
      *
-     * @throws Loguea error si la carga falla, pero no lanza excepción
-     *         (m_Texture será nullptr)
+     * @throws Loguea error si la ruta está vacía, pero no lanza excepción
+     *         (m_Texture será inválido)
      */
-    SpriteComponent(const std::string &filePath, SDL_Renderer *renderer);
-
-    /**
-     * @brief Libera la textura
-     */
-    ~SpriteComponent();
+    SpriteComponent(const std::string &filePath, AssetLoader &assets);
 };
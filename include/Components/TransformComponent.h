@@ -9,6 +9,7 @@
  * Responsabilidades:
  * - Almacenar posición (x, y) en píxeles
  * - Almacenar velocidad (vx, vy) en píxeles/segundo
+ * - Guardar la posición del tick anterior (interpolación de render)
  *
  * Usado por:
  * - MovementSystem: Aplica velocidad a posición
@@ -24,8 +25,9 @@ class TransformComponent : public Component
 {
 public:
     // ===== TRANSFORMACIÓN =====
-    glm::vec2 m_Position; ///< Posición actual en el mundo (píxeles)
-    glm::vec2 m_Velocity; ///< Velocidad actual (píxeles/segundo)
+    glm::vec2 m_Position;         ///< Posición actual en el mundo (píxeles)
+    glm::vec2 m_Velocity;         ///< Velocidad actual (píxeles/segundo)
+    glm::vec2 m_PreviousPosition; ///< Posición al inicio del último tick (MovementSystem)
 
     // ===== CONSTRUCTOR =====
     /**
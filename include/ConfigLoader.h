@@ -1,9 +1,12 @@
 #pragma once
 #include <string>
 #include <json.hpp>
+#include "BehaviorTable.h"
 
 using json = nlohmann::json;
 
+class JobSystem;
+
 /**
  * @class ConfigLoader
  * @brief Carga y valida toda la configuración del juego desde archivos JSON
@@ -24,9 +27,22 @@ public:
         std::string title = "Mega Man ECS Engine";
     };
 
+    /**
+     * @brief Tamaño del mundo (sección "world" de settings.json), independiente de la ventana
+     */
+    struct WorldConfig
+    {
+        float width = 0.0f;  // Ancho del mundo en píxeles (<= 0 = ancho de la ventana)
+        float height = 0.0f; // Alto del mundo en píxeles (<= 0 = alto de la ventana)
+    };
+
     struct GameplayConfig
     {
         float playerSpeed = 400.0f;
+
+        bool fixedTimestep = true; // Simulación a paso fijo (acumulador) con render interpolado
+        int tickRate = 60;         // Ticks de simulación por segundo
+        int maxCatchUpSteps = 5;   // Máximo de ticks por frame (evita la espiral de la muerte)
     };
 
     struct CollisionConfig
@@ -36,6 +52,88 @@ public:
         float playerInvulnerabilityDuration = 3.0f;
     };
 
+    /**
+     * @brief Parámetros de IA compartidos por todos los enemigos (sección "ai" de settings.json)
+     */
+    struct AIConfig
+    {
+        bool flowFieldEnabled = true;     // Usar campo de flujo en lugar de persecución directa
+        float flowFieldCellSize = 40.0f;  // Tamaño de celda de la rejilla (píxeles)
+        float flowFieldClearance = 24.0f; // Margen alrededor de obstáculos (píxeles)
+
+        bool lodEnabled = true;           // Actualizar enemigos lejanos en rodajas (round-robin)
+        float lodNearDistance = 700.0f;   // Distancia al jugador bajo la cual se actualiza cada frame
+        int lodFarInterval = 4;           // Los lejanos se actualizan ~cada N frames
+        int maxUpdatesPerFrame = 256;     // Presupuesto de IA por frame (recorta solo a los lejanos)
+
+        bool separationEnabled = true;    // Separación entre enemigos (boids) antes de moverse
+        float separationRadius = 100.0f;  // Radio de vecindad (píxeles)
+        float separationWeight = 0.6f;    // Fuerza de separación (fracción de baseSpeed)
+        float cohesionWeight = 0.0f;      // Fuerza de cohesión hacia el centro del grupo (0 = desactivada)
+
+        bool obstacleAvoidEnabled = true;    // Evitar obstáculos siguiendo el gradiente del SDF
+        float obstacleAvoidDistance = 60.0f; // Holgura bajo la cual empieza a empujar (píxeles)
+        float obstacleAvoidWeight = 0.8f;    // Fuerza máxima de evitación (fracción de baseSpeed)
+    };
+
+    /**
+     * @brief Hilos de simulación (sección "threading" de settings.json)
+     */
+    struct ThreadingConfig
+    {
+        int workerThreads = -1;   // Trabajadores del JobSystem (-1 = núcleos - 1, 0 = serie)
+        bool forceSerial = false; // Ejecutar los sistemas en serie (depuración)
+    };
+
+    /**
+     * @brief Carga asíncrona de texturas (sección "assets" de settings.json)
+     */
+    struct AssetsConfig
+    {
+        int decodeThreads = 1;            // Hilos que decodifican PNG (mínimo 1)
+        int maxUploadsPerFrame = 4;       // Texturas subidas a GPU por frame (<= 0 = sin límite)
+        float prefetchLeadTime = 5.0f;    // Segundos antes del final de oleada para precargar la siguiente
+        float unusedTextureGrace = -1.0f; // Segundos sin referencias antes de liberar una textura (< 0 = nunca)
+        int atlasPageSize = 2048;         // Lado de las páginas del atlas de sprites (<= 0 = sin atlas)
+    };
+
+    /**
+     * @brief Dibujo en el hilo principal (sección "render" de settings.json)
+     */
+    struct RenderConfig
+    {
+        bool batching = true;       // Agrupar quads en lotes SDL_RenderGeometry (false = una llamada por quad)
+        bool cacheLayers = true;    // Fondo + obstáculos y panel del HUD en render targets cacheados
+        float statsInterval = 0.0f; // Segundos entre informes de llamadas de dibujo por frame (<= 0 = desactivado)
+    };
+
+    /**
+     * @brief Servidor headless de partidas (sección "server" de settings.json)
+     */
+    struct ServerConfig
+    {
+        int matches = 64;                          // Partidas por lote
+        int threads = -1;                          // Hilos del lote (-1 = un hilo por núcleo)
+        float maxMatchTime = 300.0f;               // Tiempo simulado máximo por partida (segundos)
+        uint32_t seed = 1;                         // Semilla de la partida 0 (la i usa seed + i)
+        std::string output = "match_results.json"; // Informe JSON ("" = solo stdout)
+        bool checkDeterminism = false;             // Repetir el lote y exigir resultados idénticos
+    };
+
+    /**
+     * @brief Parámetros de los disparos del jugador (sección "projectiles" de settings.json)
+     */
+    struct ProjectileConfig
+    {
+        int capacity = 512;     // Máximo de proyectiles vivos (pool de tamaño fijo)
+        float speed = 900.0f;   // Velocidad (píxeles/segundo)
+        float lifetime = 1.2f;  // Segundos hasta expirar
+        int damage = 1;         // Daño por impacto
+        float fireRate = 10.0f; // Disparos por segundo con la tecla mantenida
+        float width = 16.0f;    // Tamaño del proyectil (píxeles)
+        float height = 8.0f;
+    };
+
     struct PlayerEntityConfig
     {
         std::string spritePath;
@@ -69,6 +167,8 @@ public:
         float focusRange;
         float velocitySmoothing;
         float lifetime;
+        BehaviorTable::TypeDef behavior;   // Máquina de estados tal como viene del JSON
+        uint16_t initialBehaviorState = 0; // Id global del estado inicial (compilado en behaviors)
     };
 
     /**
@@ -77,6 +177,7 @@ public:
     struct EnemyEntityConfig
     {
         std::vector<EnemyTypeConfig> enemyTypes;
+        BehaviorTable behaviors; // Estados/transiciones compilados de todos los tipos
     };
     /**
      * @brief Configuración de un fondo por fase
@@ -192,6 +293,18 @@ public:
      */
     bool LoadObstaclesByPhaseConfig(const std::string &path = "./assets/config/ObstaculosByFase.json");
 
+    /**
+     * @brief Carga los JSON de entidades, oleadas y obstáculos (todo salvo settings.json)
+     *
+     * Cada archivo escribe solo su propia sección, así que con jobs se parsean
+     * todos a la vez (un trabajo por archivo); sin jobs, uno tras otro.
+     * Los obstáculos son opcionales: solo jugador, enemigos y oleadas hacen fallar.
+     *
+     * @param jobs Pool donde repartir los archivos (nullptr = en serie)
+     * @return true si se cargaron los archivos obligatorios
+     */
+    bool LoadGameConfigs(JobSystem *jobs = nullptr);
+
     /**
      * @brief Calcula la posición de spawn del jugador basada en dimensiones de mundo
      * @param worldWidth Ancho del mundo
@@ -201,8 +314,15 @@ public:
 
     // Getters para acceder a la configuración cargada
     const WindowConfig &GetWindow() const { return m_Window; }
+    const WorldConfig &GetWorld() const { return m_World; }
     const GameplayConfig &GetGameplay() const { return m_Gameplay; }
     const CollisionConfig &GetCollision() const { return m_Collision; }
+    const AIConfig &GetAI() const { return m_AI; }
+    const ThreadingConfig &GetThreading() const { return m_Threading; }
+    const AssetsConfig &GetAssets() const { return m_Assets; }
+    const ServerConfig &GetServer() const { return m_Server; }
+    const RenderConfig &GetRender() const { return m_Render; }
+    const ProjectileConfig &GetProjectiles() const { return m_Projectiles; }
     const PlayerEntityConfig &GetPlayerEntity() const { return m_PlayerEntity; }
     const EnemyEntityConfig &GetEnemyEntity() const { return m_EnemyEntity; }
     const WavesData &GetWaves() const { return m_Waves; }
@@ -211,8 +331,15 @@ public:
 
 private:
     WindowConfig m_Window;
+    WorldConfig m_World;
     GameplayConfig m_Gameplay;
     CollisionConfig m_Collision;
+    AIConfig m_AI;
+    ProjectileConfig m_Projectiles;
+    ThreadingConfig m_Threading;
+    AssetsConfig m_Assets;
+    ServerConfig m_Server;
+    RenderConfig m_Render;
     PlayerEntityConfig m_PlayerEntity;
     EnemyEntityConfig m_EnemyEntity;
     WavesData m_Waves;
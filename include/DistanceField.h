@@ -0,0 +1,88 @@
+#pragma once
+#include <vector>
+#include <glm/glm.hpp>
+
+/**
+ * @class DistanceField
+ * @brief Campo de distancia con signo (SDF) de baja resolución de los obstáculos estáticos.
+ *
+ * Responsabilidades:
+ * - Guardar, en una rejilla de nodos, la distancia al obstáculo más cercano
+ *   (positiva fuera, negativa dentro)
+ * - Responder distancia y gradiente en O(1) con interpolación bilineal
+ *
+ * Construcción:
+ * - Build() recibe los rectángulos de los obstáculos de la fase (pivote arriba-izquierda)
+ * - Coste O(nodos * obstáculos); se hace una vez al iniciar la fase (WaveSystem::StartWave)
+ *
+ * Precisión:
+ * - La distancia es 1-Lipschitz, así que el error de interpolación es <= GetCellSize()
+ * - Fuera de la rejilla se devuelve una cota inferior (distancia del borde - desplazamiento)
+ *
+ * Usado por:
+ * - EnemyAISystem: Evitación suave siguiendo el gradiente
+ * - CollisionSystem: Descarte temprano de enemigos lejos de todo obstáculo
+ */
+class DistanceField
+{
+public:
+    // ===== CONSTRUCCIÓN =====
+    /**
+     * @brief Calcula el campo para un conjunto de rectángulos
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     * @param cellSize Separación entre nodos (píxeles)
+     * @param rects Rectángulos (x, y, ancho, alto)
+     */
+    void Build(float worldWidth, float worldHeight, float cellSize, const std::vector<glm::vec4> &rects);
+
+    /**
+     * @brief Vacía el campo (sin obstáculos)
+     */
+    void Clear();
+
+    // ===== CONSULTA =====
+    /**
+     * @brief ¿Hay obstáculos en el campo?
+     */
+    bool IsEmpty() const { return m_Distances.empty(); }
+
+    /**
+     * @brief Separación entre nodos (cota del error de interpolación)
+     */
+    float GetCellSize() const { return m_CellSize; }
+
+    /**
+     * @brief Distancia con signo al obstáculo más cercano
+     * @param position Punto a consultar
+     * @return Distancia (píxeles); muy grande si el campo está vacío
+     */
+    float Sample(const glm::vec2 &position) const;
+
+    /**
+     * @brief Gradiente de la distancia (dirección de alejamiento de los obstáculos)
+     * @param position Punto a consultar
+     * @return Vector unitario, o (0,0) si el campo está vacío o es plano
+     */
+    glm::vec2 Gradient(const glm::vec2 &position) const;
+
+private:
+    // ===== REJILLA =====
+    float m_CellSize = 1.0f;        ///< Separación entre nodos (píxeles)
+    int m_Cols = 0;                 ///< Nodos por fila
+    int m_Rows = 0;                 ///< Nodos por columna
+    std::vector<float> m_Distances; ///< Distancia por nodo (fila mayor)
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Localiza la celda y los pesos bilineales de un punto ya limitado a la rejilla
+     */
+    void Locate(const glm::vec2 &position, int &col, int &row, float &fx, float &fy) const;
+
+    /**
+     * @brief Limita un punto al área cubierta por la rejilla
+     */
+    glm::vec2 ClampToGrid(const glm::vec2 &position) const;
+
+    float At(int col, int row) const { return m_Distances[row * m_Cols + col]; }
+};
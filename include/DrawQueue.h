@@ -0,0 +1,124 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+class SpriteBatch;
+
+/**
+ * @class DrawQueue
+ * @brief Cola de comandos de dibujo de un frame, ordenada por clave de 64 bits antes de enviarla.
+ *
+ * Responsabilidades:
+ * - PushSprite / PushRect: guardar el quad y un comando {clave, índice}
+ * - Sort: radix sort LSD de las claves (8 pasadas de 8 bits; se saltan los
+ *   dígitos iguales en todos los comandos)
+ * - Submit: recorrer los comandos ordenados y pasar los quads al SpriteBatch
+ *
+ * Clave (de más a menos significativo):
+ *   capa (8) | profundidad (32) | textura (24)
+ * - Capa: orden de pintado entre capas (RenderLayer)
+ * - Profundidad: borde inferior del sprite en capas con orden Y (vista cenital);
+ *   0 en las demás, donde la textura pasa a decidir y los quads de la misma
+ *   textura quedan juntos (lotes más largos)
+ * - Textura: id pequeño asignado por orden de aparición en el frame
+ * - Sin campo de secuencia: el radix sort LSD es estable, así que a igual clave
+ *   se conserva el orden de emisión sin límite de comandos por frame
+ *
+ * Uso (hilo principal, una vez por frame):
+ *   queue.Clear();
+ *   queue.PushSprite(layer, depth, texture, source, dst);
+ *   queue.Sort();
+ *   queue.Submit(batch);
+ */
+class DrawQueue
+{
+public:
+    // ===== CLAVES =====
+    static constexpr uint32_t MAX_DEPTH = 0xFFFFFFFF;    ///< Profundidad máxima (32 bits)
+    static constexpr uint32_t MAX_TEXTURE_ID = 0xFFFFFF; ///< Id de textura máximo (24 bits)
+
+    /**
+     * @brief Compone una clave de ordenación
+     */
+    static uint64_t MakeKey(uint8_t layer, uint32_t depth, uint32_t texture);
+
+    /**
+     * @brief Profundidad para orden Y: coordenada Y en cuartos de píxel (saturada a 32 bits)
+     * @param y Borde inferior del sprite en píxeles (más abajo = se pinta después)
+     */
+    static uint32_t DepthFromY(float y);
+
+    // ===== FRAME =====
+    /**
+     * @brief Vacía la cola conservando la capacidad
+     */
+    void Clear();
+
+    /**
+     * @brief Encola un quad texturizado
+     * @param layer Capa de dibujo
+     * @param depth Profundidad dentro de la capa (DepthFromY, o 0 sin orden Y)
+     * @param texture Textura o página de atlas (nullptr = se ignora)
+     * @param source Rectángulo origen (nullptr = textura completa)
+     * @param dst Rectángulo destino
+     */
+    void PushSprite(uint8_t layer, uint32_t depth, SDL_Texture *texture, const SDL_FRect *source, const SDL_FRect &dst);
+
+    /**
+     * @brief Encola un rectángulo de color sólido
+     */
+    void PushRect(uint8_t layer, uint32_t depth, const SDL_FRect &dst, SDL_FColor color);
+
+    /**
+     * @brief Ordena los comandos por clave (estable)
+     */
+    void Sort();
+
+    /**
+     * @brief Envía los quads al batch en el orden de las claves
+     */
+    void Submit(SpriteBatch &batch) const;
+
+    // ===== CONSULTAS =====
+    size_t GetSize() const { return m_Commands.size(); }
+
+private:
+    /**
+     * @struct Command
+     * @brief Clave de ordenación + índice del quad (16 bytes: la ordenación no mueve los quads)
+     */
+    struct Command
+    {
+        uint64_t key;
+        uint32_t quad;
+    };
+
+    /**
+     * @struct Quad
+     * @brief Quad resuelto (textura nullptr = color sólido)
+     */
+    struct Quad
+    {
+        SDL_Texture *texture;
+        SDL_FRect source;
+        SDL_FRect dst;
+        SDL_FColor color;
+        bool hasSource;
+    };
+
+    std::vector<Quad> m_Quads;             ///< Datos de dibujo, en orden de emisión
+    std::vector<Command> m_Commands;       ///< Comandos (ordenados tras Sort)
+    std::vector<Command> m_Scratch;        ///< Buffer auxiliar del radix sort
+    std::vector<SDL_Texture *> m_Textures; ///< Texturas vistas en el frame (índice = id de la clave)
+
+    /**
+     * @brief Id de textura para la clave (0 = color sólido; a partir de MAX_TEXTURE_ID comparten id)
+     */
+    uint32_t TextureId(SDL_Texture *texture);
+
+    /**
+     * @brief Añade el comando del último quad
+     */
+    void PushCommand(uint8_t layer, uint32_t depth, SDL_Texture *texture);
+};
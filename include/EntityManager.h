@@ -2,10 +2,10 @@
 #include "Entity.h"
 #include "World.h"
 #include "ConfigLoader.h"
+#include "AssetLoader.h"
 #include <SDL3/SDL.h>
 #include <string>
 #include <vector>
-#include <random>
 
 /**
  * @class EntityManager
@@ -14,19 +14,40 @@
  * Responsabilidades:
  * - Crear enemigos con configuración desde JSON
  * - Crear obstáculos en posiciones específicas
- * - Generar posiciones y velocidades aleatorias
+ * - Crear el jugador a partir de su configuración
+ * - Generar posiciones y velocidades aleatorias (con World::GetRng)
  * - Ensamblar componentes para entidades completas
  *
  * Nota: NO es un Factory Pattern clásico.
  *       Es un conjunto de funciones helper para creación de entidades.
  *
  * Uso:
- *   EntityManager::CreateEnemy(world, renderer, types, "Enemigo1", 1.5f);
- *   EntityManager::CreateObstacle(world, renderer, config, x, y);
+ *   EntityManager::CreatePlayer(world, assets, playerConfig);
+ *   EntityManager::CreateEnemy(world, assets, types, "Enemigo1", worldWidth, worldHeight, 1.5f);
+ *   EntityManager::CreateObstacle(world, assets, config, x, y);
  */
 class EntityManager
 {
 public:
+    // ===================
+    // CREAR JUGADOR
+    // ===================
+    /**
+     * @brief Crea el jugador en su posición de spawn precalculada
+     *
+     * Componentes: PlayerComponent, TransformComponent, SpriteComponent,
+     * ColliderComponent, HealthComponent
+     *
+     * @param world Mundo donde crear la entidad
+     * @param assets Cargador de texturas para sprites
+     * @param config Configuración del jugador (CalculatePlayerSpawnPosition ya aplicado)
+     * @return Referencia a la entidad creada
+     */
+    static Entity &CreatePlayer(
+        World &world,
+        AssetLoader &assets,
+        const ConfigLoader::PlayerEntityConfig &config);
+
     // ===================
     // CREAR ENEMIGO
     // ===================
@@ -35,22 +56,26 @@ public:
      *
      * Lógica COMPLEJA:
      *   1. Buscar tipo de enemigo por nombre
-     *   2. Generar posición aleatoria
+     *   2. Generar posición aleatoria (RNG del World: reproducible con SeedRng)
      *   3. Generar velocidad aleatoria (basada en ángulo aleatorio)
      *   4. Crear entidad con 4 componentes:
      *      - EnemyComponent, SpriteComponent, ColliderComponent, TransformComponent
      *
      * @param world Mundo donde crear la entidad
-     * @param renderer Renderer SDL para sprites
+     * @param assets Cargador de texturas para sprites
      * @param enemyTypes Vector de configuraciones de enemigos
      * @param enemyTypeName Nombre del tipo ("Enemigo1", etc.)
+     * @param worldWidth Ancho del mundo (límite de la posición aleatoria)
+     * @param worldHeight Alto del mundo (límite de la posición aleatoria)
      * @param speedMultiplier Multiplicador de velocidad (default 1.0)
      */
     static void CreateEnemy(
         World &world,
-        SDL_Renderer *renderer,
+        AssetLoader &assets,
         const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes,
         const std::string &enemyTypeName,
+        float worldWidth,
+        float worldHeight,
         float speedMultiplier = 1.0f);
 
     // ===================
@@ -66,14 +91,14 @@ public:
      *   4. Sin IA
      *
      * @param world Mundo donde crear la entidad
-     * @param renderer Renderer SDL para sprites
+     * @param assets Cargador de texturas para sprites
      * @param config Configuración del obstáculo
      * @param x Posición X
      * @param y Posición Y
      */
     static void CreateObstacle(
         World &world,
-        SDL_Renderer *renderer,
+        AssetLoader &assets,
         const ConfigLoader::ObstacleConfig &config,
         float x,
         float y);
@@ -82,17 +107,10 @@ public:
     // EXTENSIÓN FUTURA
     // ===================
     // Puedes agregar más funciones helper aquí:
-    // static void CreateProjectile(...);
+    // (Los proyectiles NO son entidades: ver ProjectileSystem / ProjectilePool)
     // static void CreatePowerUp(...);
     // static void CreateParticle(...);
     // static Entity* FindNearestEnemy(World &world, float x, float y);
     // static void ClearAllDead(World &world);
     // static int GetEnemyCount(World &world);
-
-private:
-    /**
-     * @brief Obtiene generador de números aleatorios (singleton)
-     * @return Referencia a std::mt19937
-     */
-    static std::mt19937 &GetRng();
 };
@@ -29,6 +29,7 @@
  * - WaveStartEvent: Comienza oleada
  * - WaveEndEvent: Termina oleada
  * - ObstacleSpawnEvent: Crear obstáculo
+ * - TimerEvent: Temporizador de entidad vencido (World::AdvanceTimers)
  */
 class Event
 {
@@ -56,7 +57,6 @@ enum class CollisionType
 {
     PLAYER_ENEMY,    ///< Jugador colisiona con enemigo
     ENEMY_ENEMY,     ///< Enemigo colisiona con enemigo
-    ENTITY_WORLD,    ///< Entidad colisiona con borde del mundo
     PLAYER_OBSTACLE, ///< Jugador colisiona con obstáculo
     ENEMY_OBSTACLE   ///< Enemigo colisiona con obstáculo
 };
@@ -255,4 +255,43 @@ public:
     ObstacleSpawnEvent(float posX, float posY);
 
     std::string getType() const override;
-};
\ No newline at end of file
+};
+
+// ========================================
+// EVENTO: TEMPORIZADOR
+// ========================================
+/**
+ * @enum TimerTag
+ * @brief Qué efecto programó el temporizador (World::ScheduleTimer)
+ */
+enum class TimerTag : uint32_t
+{
+    ENEMY_LIFETIME ///< El enemigo agotó su lifetime: eliminarlo
+};
+
+/**
+ * @class TimerEvent
+ * @brief Notifica que venció un temporizador programado para una entidad.
+ *
+ * Responsabilidades:
+ * - Emitida por World::AdvanceTimers (rueda de temporización)
+ * - La entidad puede haber sido eliminada antes: el procesador debe comprobarlo
+ *
+ * Procesadores:
+ * - LifetimeSystem: ENEMY_LIFETIME -> elimina el enemigo
+ */
+class TimerEvent : public Event
+{
+public:
+    uint32_t entityId; ///< Entidad asociada al temporizador
+    TimerTag tag;      ///< Efecto programado
+
+    /**
+     * @brief Constructor
+     * @param id ID de la entidad
+     * @param timerTag Efecto programado
+     */
+    TimerEvent(uint32_t id, TimerTag timerTag);
+
+    std::string getType() const override;
+};
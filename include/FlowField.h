@@ -0,0 +1,90 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <glm/glm.hpp>
+
+class Entity; // Forward declaration
+
+/**
+ * @class FlowField
+ * @brief Campo de flujo en rejilla compartido por todos los enemigos.
+ *
+ * Responsabilidades:
+ * - Discretizar el mundo en celdas de tamaño fijo
+ * - Marcar celdas bloqueadas por obstáculos (AABB inflado por un margen)
+ * - Calcular un campo de integración (Dijkstra 8-vecinos) desde la celda del jugador
+ * - Derivar una dirección unitaria por celda hacia el vecino de menor coste
+ *
+ * Coste:
+ * - El campo se recalcula SOLO cuando el jugador cambia de celda
+ *   o cuando cambia el layout de obstáculos
+ * - Cada enemigo obtiene su dirección con una única consulta O(1)
+ * - El coste total no depende del número de enemigos
+ *
+ * Usado por:
+ * - EnemyAISystem: Sustituye la persecución en línea recta
+ */
+class FlowField
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Inicializa la rejilla cubriendo el mundo completo
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     * @param cellSize Tamaño de cada celda (píxeles)
+     */
+    FlowField(float worldWidth, float worldHeight, float cellSize);
+
+    // ===== CONSTRUCCIÓN =====
+    /**
+     * @brief Marca las celdas ocupadas por obstáculos
+     * @param obstacles Caché de obstáculos del World
+     * @param clearance Margen extra alrededor de cada obstáculo (píxeles)
+     *
+     * Invalida el campo: el siguiente Update() recalcula aunque el jugador no se mueva.
+     */
+    void SetObstacles(const std::vector<Entity *> &obstacles, float clearance);
+
+    /**
+     * @brief Recalcula el campo si el objetivo cambió de celda (o si está sucio)
+     * @param target Posición objetivo (centro del jugador)
+     * @return true si se recalculó el campo
+     */
+    bool Update(const glm::vec2 &target);
+
+    // ===== CONSULTA =====
+    /**
+     * @brief Dirección de flujo en una posición del mundo
+     * @param position Posición a consultar (centro del enemigo)
+     * @return Vector unitario hacia el objetivo, o (0,0) si la celda es la del objetivo,
+     *         es inalcanzable o está fuera del mundo (usar persecución directa)
+     */
+    glm::vec2 Sample(const glm::vec2 &position) const;
+
+private:
+    // ===== REJILLA =====
+    float m_CellSize; ///< Tamaño de celda (píxeles)
+    int m_Cols;       ///< Número de columnas
+    int m_Rows;       ///< Número de filas
+
+    // ===== CAMPOS (row-major, índice = row * m_Cols + col) =====
+    std::vector<uint8_t> m_Blocked;        ///< 1 si la celda está ocupada por un obstáculo
+    std::vector<uint32_t> m_Cost;          ///< Coste acumulado hasta el objetivo (UINT32_MAX = inalcanzable)
+    std::vector<glm::vec2> m_Directions;   ///< Dirección unitaria precalculada por celda
+
+    // ===== ESTADO =====
+    int m_TargetCell; ///< Celda objetivo del último cálculo (-1 = ninguna)
+    bool m_Dirty;     ///< Flag: ¿Obstáculos cambiaron desde el último cálculo?
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Índice de celda para una posición, o -1 si está fuera del mundo
+     */
+    int CellIndex(const glm::vec2 &position) const;
+
+    /**
+     * @brief Dijkstra desde la celda objetivo y generación de direcciones
+     */
+    void Compute(int targetCell);
+};
@@ -7,6 +7,15 @@
 #include <SDL3_image/SDL_image.h>
 #include <spdlog/spdlog.h>
 #include <memory>
+#include <atomic>
+#include "JobSystem.h"
+#include "SystemScheduler.h"
+#include "SystemPipeline.h"
+#include "RenderSnapshot.h"
+#include "InputQueue.h"
+#include "AssetLoader.h"
+#include "ConfigLoader.h"
+#include "SpriteBatch.h"
 
 // ========================================
 // GameContext: Encapsula contexto global
@@ -23,11 +32,17 @@ struct GameContext
     SDL_Renderer *renderer = nullptr; // Contexto de renderizado SDL3
     float worldWidth = 0.0f;          // Ancho del mundo (píxeles)
     float worldHeight = 0.0f;         // Alto del mundo (píxeles)
+    float viewWidth = 0.0f;           // Ancho de la vista / ventana (píxeles; = mundo por defecto)
+    float viewHeight = 0.0f;          // Alto de la vista / ventana (píxeles; = mundo por defecto)
+    JobSystem *jobs = nullptr;        // Pool de hilos para ParallelFor (nullptr = serie)
+    AssetLoader *assets = nullptr;    // Carga asíncrona de texturas
+    SpriteBatch *batch = nullptr;     // Lotes de quads del hilo principal (nullptr = sin dibujo)
 
     GameContext() = default;
 
-    GameContext(SDL_Renderer *r, float w, float h)
-        : renderer(r), worldWidth(w), worldHeight(h)
+    GameContext(SDL_Renderer *r, float w, float h, JobSystem *j = nullptr, AssetLoader *a = nullptr,
+                SpriteBatch *b = nullptr)
+        : renderer(r), worldWidth(w), worldHeight(h), viewWidth(w), viewHeight(h), jobs(j), assets(a), batch(b)
     {
     }
 };
@@ -43,6 +58,23 @@ struct GameContext
 #include "Systems/HUDSystem.h"
 #include "Systems/WaveManagerSystem.h"
 #include "Systems/MusicSystem.h"
+#include "Systems/ProjectileSystem.h"
+
+/**
+ * @brief Sistemas de Update() en su orden serie: única lista del orden de la simulación
+ *
+ * SystemScheduler se registra recorriéndola (SimulationPipeline::ForEach).
+ */
+using SimulationPipeline = SystemPipeline<WaveManagerSystem, PlayerInputSystem, EnemyAISystem,
+                                          MovementSystem, ProjectileSystem, CollisionSystem,
+                                          CollisionResponseSystem, DamageSystem>;
+
+/**
+ * @brief Nombre de cada etapa de SimulationPipeline (mismo orden que los tipos)
+ */
+constexpr std::array<const char *, SimulationPipeline::STAGE_COUNT> SIMULATION_STAGE_NAMES{
+    "WaveManager", "PlayerInput", "EnemyAI", "Movement",
+    "Projectile", "Collision", "CollisionResponse", "Damage"};
 
 /**
  * @class Game
@@ -51,17 +83,33 @@ struct GameContext
  * Responsabilidades:
  * - Inicialización de SDL y sistemas ECS
  * - Gestión del loop principal (ProcessInput → Update → Render)
+ * - Paso fijo: acumulador de tiempo real, N ticks de simulación por frame
+ *   (limitados por maxCatchUpSteps) y render interpolado entre los dos últimos ticks
+ * - Dos hilos: la simulación (SimulationLoop) publica un RenderSnapshot por frame
+ *   en un triple buffer; el hilo principal procesa eventos SDL y dibuja el último
+ *   snapshot publicado (el frame N se dibuja mientras se simula el N+1)
+ * - Input con timestamps: el hilo principal encola cada transición de tecla en
+ *   InputQueue y cada tick consume las que cayeron dentro de su intervalo real
+ * - Texturas vía AssetLoader: PNG decodificados en hilos propios y subidos a
+ *   GPU por el hilo principal con un límite por frame
  * - Orquestación del ciclo de vida del juego
+ * - Arranque en paralelo: los JSON, el WAV y la decodificación de los sprites
+ *   iniciales corren en el JobSystem mientras el hilo principal crea la ventana;
+ *   el desglose por fases se loguea tras el primer frame
+ * - Simulación vía SystemScheduler: sistemas sin conflicto de datos en paralelo
+ *   sobre JobSystem (el orden de registro es el orden serie de referencia); en
+ *   serie, vía SimulationPipeline (llamadas directas, orden fijado en compilación)
  *
  * Arquitectura:
  * - PlayerInputSystem → Procesa input de teclado
  * - MovementSystem → Actualiza posiciones
  * - CollisionSystem → Detecta colisiones
  * - CollisionResponseSystem → Resuelve colisiones
+ * - ProjectileSystem → Disparos del jugador (pool SoA, impactos → DamageEvent)
  * - DamageSystem → Aplica daño
  * - EnemyAISystem → IA de enemigos
- * - RenderSystem → Renderiza sprites
- * - HUDSystem → Interfaz de usuario
+ * - RenderSystem → Captura sprites en el snapshot / los dibuja
+ * - HUDSystem → Interfaz de usuario (captura / dibujo)
  * - WaveManagerSystem → Orquesta ondas y obstáculos
  */
 class Game
@@ -72,27 +120,64 @@ private:
     SDL_Renderer *m_Renderer; ///< Contexto de renderizado SDL3
     float m_Ancho;            ///< Ancho de la ventana (píxeles)
     float m_Alto;             ///< Alto de la ventana (píxeles)
+    float m_WorldWidth;       ///< Ancho del mundo (píxeles; la cámara recorre lo que no cabe)
+    float m_WorldHeight;      ///< Alto del mundo (píxeles)
 
     // ===== ESTADO DEL JUEGO =====
-    bool m_IsRunning;       ///< True mientras el juego está activo
-    bool m_GameOver;        ///< True cuando el jugador muere
-    bool m_GameOverPrinted; ///< Flag para imprimir Game Over una sola vez
-    World m_World;          ///< Almacén central de entidades y eventos
+    std::atomic<bool> m_IsRunning; ///< True mientras el juego está activo (ambos hilos)
+    std::atomic<bool> m_GameOver;  ///< True cuando el jugador muere (lo escribe la simulación)
+    bool m_GameOverPrinted;        ///< Flag para imprimir Game Over una sola vez (hilo principal)
+    World m_World;                 ///< Almacén central de entidades y eventos (solo simulación)
+
+    // ===== PASO FIJO =====
+    bool m_FixedTimestep;   ///< ¿Simulación a paso fijo? (false = dt variable)
+    float m_FixedDeltaTime; ///< Duración de un tick (segundos)
+    int m_MaxCatchUpSteps;  ///< Máximo de ticks por frame
+    double m_Accumulator;   ///< Tiempo real pendiente de simular (segundos)
+
+    // ===== HILOS SIMULACIÓN / RENDER =====
+    std::unique_ptr<RenderSnapshotBuffer> m_Snapshots; ///< Triple buffer simulación → render
+    InputQueue m_Input;                                ///< Transiciones de teclado hilo principal → simulación
+    std::vector<InputEvent> m_TickInput;               ///< Buffer reutilizado de transiciones de un tick
+    Uint64 m_InputClockNs;                             ///< Instante real hasta el que ya se simuló el input
+
+    // ===== ARRANQUE =====
+    ConfigLoader::PlayerEntityConfig m_PlayerConfig;              ///< Config del jugador (parseada en Initialize)
+    Uint64 m_StartupNs;                                           ///< SDL_GetTicksNS() al entrar en Initialize
+    Uint64 m_StartupPhaseNs;                                      ///< Inicio de la fase de arranque en curso
+    std::vector<std::pair<const char *, double>> m_StartupPhases; ///< (fase, ms) para el informe de arranque
+
+    // ===== CONCURRENCIA =====
+    std::unique_ptr<JobSystem> m_JobSystem; ///< Pool de hilos (vive más que los sistemas)
+    std::unique_ptr<AssetLoader> m_Assets;  ///< Texturas: decodificación en segundo plano
+
+    // ===== DIBUJO =====
+    std::unique_ptr<SpriteBatch> m_Batch; ///< Lotes de quads de RenderSystem y HUDSystem
+    Uint64 m_RenderStatsIntervalNs;       ///< Periodo del informe de llamadas de dibujo (0 = desactivado)
+    Uint64 m_RenderStatsStartNs;          ///< Inicio de la ventana de medida actual
+    uint64_t m_RenderStatsFrames;         ///< Frames dibujados en la ventana
+    uint64_t m_RenderStatsCalls;          ///< Llamadas de dibujo acumuladas en la ventana
+    uint64_t m_RenderStatsQuads;          ///< Quads acumulados (= llamadas sin batching)
 
     // ===== SISTEMAS ECS =====
     std::unique_ptr<PlayerInputSystem> m_PlayerInputSystem;             ///< Input del jugador
     std::unique_ptr<MovementSystem> m_MovementSystem;                   ///< Aplicar velocidad
-    std::unique_ptr<RenderSystem> m_RenderSystem;                       ///< Renderizar sprites
+    std::unique_ptr<RenderSystem> m_RenderSystem;                       ///< Capturar/dibujar sprites
     std::unique_ptr<CollisionSystem> m_CollisionSystem;                 ///< Detectar colisiones
     std::unique_ptr<CollisionResponseSystem> m_CollisionResponseSystem; ///< Resolver colisiones
     std::unique_ptr<DamageSystem> m_DamageSystem;                       ///< Sistema de daño
     std::unique_ptr<EnemyAISystem> m_EnemyAISystem;                     ///< IA de enemigos
     std::unique_ptr<HUDSystem> m_HUDSystem;                             ///< Interfaz de usuario
+    std::unique_ptr<ProjectileSystem> m_ProjectileSystem;               ///< Disparos del jugador
 
     // ===== MANAGER CENTRAL =====
     std::unique_ptr<WaveManagerSystem> m_WaveManagerSystem; ///< Orquesta: Waves, Background, Spawn, Lifetime
     std::unique_ptr<MusicSystem> m_MusicSystem;             ///< Sistema de música de fondo
 
+    // ===== PLANIFICADOR =====
+    std::unique_ptr<SystemScheduler> m_Scheduler;   ///< Ejecuta los sistemas de Update() según su DAG
+    std::unique_ptr<SimulationPipeline> m_Pipeline; ///< Mismo orden en serie, sin despacho virtual
+
 public:
     // ===== CICLO DE VIDA =====
     Game();
@@ -105,22 +190,59 @@ public:
     bool Initialize();
 
     /**
-     * @brief Crea el jugador y sus componentes
+     * @brief SDL_Init + ventana + renderer (hilo principal, mientras los JSON se parsean)
+     * @param window Tamaño y título de la ventana
+     * @return true si todo se creó correctamente
+     */
+    bool InitializeSDL(const ConfigLoader::WindowConfig &window);
+
+    /**
+     * @brief Pide al AssetLoader los sprites y el primer fondo (cualquier hilo)
+     * @param config Configuración con los JSON de entidades, oleadas y obstáculos ya cargados
+     */
+    void PreloadTextures(const ConfigLoader &config);
+
+    /**
+     * @brief Cierra la fase de arranque en curso y la guarda para el informe
+     * @param name Nombre de la fase
+     */
+    void MarkStartupPhase(const char *name);
+
+    /**
+     * @brief Loguea el desglose por fases y el tiempo hasta el primer frame
+     */
+    void LogStartupReport() const;
+
+    /**
+     * @brief Crea el jugador y espera a sus texturas iniciales
      * @return true si el jugador se creó correctamente
      */
     bool Start();
 
     /**
-     * @brief Loop principal del juego (input → update → render)
+     * @brief Loop principal del juego: arranca SimulationLoop y dibuja snapshots
+     *
+     * El hilo principal procesa eventos, sube las texturas ya decodificadas
+     * (AssetLoader::ProcessUploads) y dibuja; al salir espera a la simulación.
      */
     void Run();
 
     // ===== ETAPAS DEL LOOP =====
     /**
-     * @brief Procesa eventos SDL (quit, teclas, etc.)
+     * @brief Procesa eventos SDL (quit, teclas, etc.) y encola las transiciones de teclado
      */
     void ProcessInput();
 
+    /**
+     * @brief Entrega al World las transiciones de teclado hasta untilNs (hilo de simulación)
+     *
+     * El tick cubre [m_InputClockNs, untilNs] en tiempo real; al terminar,
+     * m_InputClockNs avanza hasta untilNs.
+     *
+     * @param untilNs Fin del tick en el reloj de SDL_GetTicksNS
+     */
+    void ApplyInput(Uint64 untilNs);
+
     /**
      * @brief Actualiza la lógica del juego
      * @param deltaTime Tiempo transcurrido en segundos
@@ -128,8 +250,31 @@ public:
     void Update(float deltaTime);
 
     /**
-     * @brief Renderiza un frame
-     * @param deltaTime Tiempo transcurrido en segundos
+     * @brief Dibuja el último RenderSnapshot publicado (hilo principal)
+     */
+    void Render();
+
+    /**
+     * @brief Acumula los contadores del SpriteBatch y loguea la media por frame cada intervalo
+     *
+     * Compara las llamadas de dibujo emitidas con las que haría el dibujo sin
+     * batching (una por quad).
+     */
+    void UpdateRenderStats();
+
+    /**
+     * @brief Bucle del hilo de simulación
+     *
+     * Paso fijo: Update(m_FixedDeltaTime) se llama mientras el acumulador lo permita
+     * (hasta m_MaxCatchUpSteps); el tiempo sobrante se descarta si se excede.
+     * Tras cada tanda de ticks publica un snapshot; sin ticks pendientes duerme.
+     */
+    void SimulationLoop();
+
+    /**
+     * @brief Captura el estado visible del World en la ranura de escritura y la publica
+     * @param simulatedTime Tiempo simulado desde el snapshot anterior (segundos)
+     * @param interpolationSpan Duración de un tick (0 = dibujar sin interpolar)
      */
-    void Render(float deltaTime);
+    void PublishSnapshot(float simulatedTime, float interpolationSpan);
 };
\ No newline at end of file
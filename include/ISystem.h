@@ -1,7 +1,58 @@
 #pragma once
+#include <cstdint>
 
 class World; // Forward declaration
 
+// ========================================
+// RECURSOS (declaración de acceso para SystemScheduler)
+// ========================================
+/**
+ * @namespace SystemResource
+ * @brief Bits de los datos que un sistema lee o escribe.
+ *
+ * Granularidad por dominio (no por tipo de componente): el jugador y los
+ * enemigos comparten TransformComponent pero son datos disjuntos.
+ *
+ * - ENTITIES: Crear/eliminar entidades. Es exclusivo: invalida punteros y
+ *   caches de World, así que conflictúa con cualquier otro sistema
+ * - EVENTS: Cola de eventos. poll() drena y re-emite toda la cola, así que
+ *   emitir y consumir son ambos escritura
+ * - MAIN_THREAD: El sistema usa estado ligado a un hilo y debe correr en el que
+ *   llama a SystemScheduler::Run (el de simulación); no es un conflicto de datos.
+ *   Las texturas no cuentan: se piden/sueltan vía AssetLoader/TextureRef (seguros
+ *   entre hilos) y solo el hilo principal las crea y destruye
+ */
+namespace SystemResource
+{
+    enum : uint32_t
+    {
+        PLAYER = 1u << 0,       ///< Componentes del jugador (Transform, Player, Health, Collider)
+        ENEMIES = 1u << 1,      ///< Componentes de enemigos (Transform, Enemy, Collider)
+        OBSTACLES = 1u << 2,    ///< Componentes de obstáculos + SDF de la fase
+        PROJECTILES = 1u << 3,  ///< Pool de proyectiles
+        ENTITIES = 1u << 4,     ///< Conjunto de entidades (create/delete)
+        EVENTS = 1u << 5,       ///< Cola de eventos de World
+        INPUT = 1u << 6,        ///< Teclado del tick (World::GetKeyHeldFraction / WasKeyDown)
+        GAME_STATE = 1u << 7,   ///< Flags de Game (running, game over)
+        MAIN_THREAD = 1u << 31, ///< Requiere el hilo que llama a Run()
+        ALL = 0xFFFFFFFFu
+    };
+}
+
+/**
+ * @struct SystemAccess
+ * @brief Qué lee y qué escribe un sistema (máscaras de SystemResource).
+ *
+ * Dos sistemas conflictúan si uno escribe algo que el otro lee o escribe;
+ * SystemScheduler mantiene el orden de registro entre sistemas en conflicto
+ * y ejecuta en paralelo el resto.
+ */
+struct SystemAccess
+{
+    uint32_t reads = SystemResource::ALL;  ///< Recursos leídos
+    uint32_t writes = SystemResource::ALL; ///< Recursos escritos
+};
+
 /**
  * @struct ISystem
  * @brief Interfaz base para todos los sistemas ECS.
@@ -28,6 +79,11 @@ class World; // Forward declaration
  *
  * Nota: El orden es crítico para evitar comportamientos incorrectos
  *       (ej: debe haber movimiento antes de colisiones)
+ *
+ * Concurrencia:
+ * - access() declara los recursos leídos/escritos; SystemScheduler solo
+ *   solapa sistemas sin conflicto, así el resultado es el del orden serie
+ * - Por defecto un sistema lee y escribe todo (se ejecuta en exclusiva)
  */
 struct ISystem
 {
@@ -38,6 +94,12 @@ struct ISystem
      */
     virtual void update(World &world, float dt) = 0;
 
+    /**
+     * @brief Recursos que lee/escribe update() (para SystemScheduler)
+     * @return Máscaras de SystemResource (por defecto: todo, en exclusiva)
+     */
+    virtual SystemAccess access() const { return SystemAccess(); }
+
     /**
      * @brief Destructor virtual para limpieza segura
      */
@@ -0,0 +1,62 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+/**
+ * @struct InputEvent
+ * @brief Transición de una tecla con la marca de tiempo de SDL
+ */
+struct InputEvent
+{
+    Uint64 timestampNs = 0;                        ///< event.key.timestamp (mismo reloj que SDL_GetTicksNS)
+    SDL_Scancode scancode = SDL_SCANCODE_UNKNOWN; ///< Tecla física
+    bool down = false;                             ///< true = pulsada, false = soltada
+};
+
+/**
+ * @class InputQueue
+ * @brief Ring buffer SPSC de transiciones de teclado, del hilo principal a la simulación.
+ *
+ * Responsabilidades:
+ * - Push (hilo principal): encolar cada KEY_DOWN / KEY_UP con su timestamp
+ * - PopUntil (simulación): sacar en orden las transiciones de un tick
+ *
+ * Por qué timestamps:
+ * - SDL marca cada evento al recibirlo del sistema, no al hacer SDL_PollEvent;
+ *   la simulación reparte las transiciones entre ticks por ese instante y
+ *   no por el frame en el que se leyeron
+ * - Una pulsación corta (bajar y subir dentro del mismo tick) no se pierde
+ *
+ * Concurrencia:
+ * - Un productor y un consumidor, sin mutex: índices atómicos acquire/release
+ * - Cola llena: la transición se descarta (con 256 ranuras no ocurre en la práctica)
+ */
+class InputQueue
+{
+public:
+    static constexpr size_t CAPACITY = 256; ///< Potencia de 2
+
+    // ===== PRODUCTOR (hilo principal) =====
+    /**
+     * @brief Encola una transición
+     * @return false si la cola estaba llena
+     */
+    bool Push(const InputEvent &event);
+
+    // ===== CONSUMIDOR (simulación) =====
+    /**
+     * @brief Saca las transiciones con timestamp <= untilNs (en orden de llegada)
+     * @param untilNs Fin del tick en el reloj de SDL_GetTicksNS
+     * @param out Vector de salida (no se limpia)
+     * @return Número de transiciones añadidas
+     */
+    size_t PopUntil(Uint64 untilNs, std::vector<InputEvent> &out);
+
+private:
+    std::array<InputEvent, CAPACITY> m_Events{}; ///< Ranuras del anillo
+    std::atomic<size_t> m_Head{0};               ///< Siguiente a leer (solo lo escribe el consumidor)
+    std::atomic<size_t> m_Tail{0};               ///< Siguiente a escribir (solo lo escribe el productor)
+};
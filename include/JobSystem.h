@@ -0,0 +1,180 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+/**
+ * @struct JobCounter
+ * @brief Trabajos pendientes de un grupo; JobSystem::Wait() espera a que llegue a 0.
+ */
+struct JobCounter
+{
+    std::atomic<int> pending{0};
+};
+
+/**
+ * @class JobSystem
+ * @brief Pool de hilos con robo de trabajo (work stealing).
+ *
+ * Responsabilidades:
+ * - Ejecutar trabajos (std::function) en N hilos trabajadores
+ * - Balancear carga: cada hilo tiene su cola; saca de su final (LIFO, caché caliente)
+ *   y, si está vacía, roba del principio de las colas ajenas (FIFO)
+ * - ParallelFor: dividir un bucle en trozos contiguos y esperar a que terminen
+ *
+ * Espera cooperativa:
+ * - Wait() no bloquea ociosamente: el hilo que espera ejecuta trabajos pendientes,
+ *   así se pueden anidar ParallelFor dentro de trabajos sin interbloqueos
+ *
+ * Modo serie:
+ * - Con 0 trabajadores todo se ejecuta en el hilo que llama (Submit ejecuta en el acto)
+ *
+ * Usado por:
+ * - SystemScheduler: Sistemas sin conflicto de datos en paralelo
+ * - CollisionSystem / EnemyAISystem: ParallelFor sobre enemigos
+ */
+class JobSystem
+{
+public:
+    using Job = std::function<void()>;
+
+    // ===== CONSTRUCTOR & DESTRUCTOR =====
+    /**
+     * @brief Arranca los hilos trabajadores
+     * @param workerCount Número de trabajadores (0 = modo serie)
+     */
+    explicit JobSystem(size_t workerCount);
+
+    /**
+     * @brief Termina los trabajadores (los trabajos encolados se descartan)
+     */
+    ~JobSystem();
+
+    JobSystem(const JobSystem &) = delete;
+    JobSystem &operator=(const JobSystem &) = delete;
+
+    // ===== TRABAJOS =====
+    /**
+     * @brief Encola un trabajo en la cola del hilo actual
+     * @param job Trabajo a ejecutar
+     * @param counter Grupo al que pertenece (se incrementa aquí, se decrementa al terminar)
+     */
+    void Submit(Job job, JobCounter &counter);
+
+    /**
+     * @brief Espera a que el grupo termine, ejecutando trabajos mientras tanto
+     * @param counter Grupo a esperar
+     */
+    void Wait(JobCounter &counter);
+
+    /**
+     * @brief Ejecuta un trabajo pendiente si hay alguno
+     * @return true si ejecutó un trabajo
+     */
+    bool RunPendingJob();
+
+    /**
+     * @brief Divide [0, count) en trozos contiguos y ejecuta body(begin, end) en paralelo
+     * @param count Número de elementos
+     * @param minChunk Tamaño mínimo de trozo (por debajo no compensa repartir)
+     * @param body Callback body(size_t begin, size_t end); no debe depender del orden
+     *
+     * Los trozos son siempre los mismos para un count dado (ChunkCount/ChunkBegin),
+     * así quien escribe salidas por trozo puede fusionarlas en orden serie.
+     */
+    template <typename Body>
+    void ParallelFor(size_t count, size_t minChunk, Body &&body)
+    {
+        const size_t chunks = ChunkCount(count, minChunk);
+        if (chunks <= 1)
+        {
+            if (count > 0)
+                body(size_t(0), count);
+            return;
+        }
+
+        JobCounter counter;
+        for (size_t chunk = 1; chunk < chunks; ++chunk)
+        {
+            const size_t begin = ChunkBegin(count, chunks, chunk);
+            const size_t end = ChunkBegin(count, chunks, chunk + 1);
+            Submit([&body, begin, end]()
+                   { body(begin, end); },
+                   counter);
+        }
+
+        // El primer trozo lo hace el hilo que llama
+        body(size_t(0), ChunkBegin(count, chunks, 1));
+        Wait(counter);
+    }
+
+    // ===== CONSULTAS =====
+    /**
+     * @brief Número de trozos que usará ParallelFor
+     */
+    size_t ChunkCount(size_t count, size_t minChunk) const
+    {
+        if (IsSerial() || count == 0)
+            return count > 0 ? 1 : 0;
+        const size_t bySize = (count + std::max<size_t>(1, minChunk) - 1) / std::max<size_t>(1, minChunk);
+        return std::max<size_t>(1, std::min(bySize, m_Workers.size() + 1));
+    }
+
+    /**
+     * @brief Primer elemento del trozo chunk (ChunkBegin(chunks) == count)
+     */
+    static size_t ChunkBegin(size_t count, size_t chunks, size_t chunk)
+    {
+        return count * chunk / chunks;
+    }
+
+    /**
+     * @brief ¿Sin trabajadores? (todo en el hilo que llama)
+     */
+    bool IsSerial() const { return m_Workers.empty(); }
+
+    /**
+     * @brief Número de hilos trabajadores
+     */
+    size_t GetWorkerCount() const { return m_Workers.size(); }
+
+private:
+    // ===== COLAS =====
+    struct WorkQueue
+    {
+        std::mutex mutex;
+        std::deque<std::pair<Job, JobCounter *>> jobs;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_Queues; ///< [0] = hilos externos, [1..N] = trabajadores
+    std::vector<std::thread> m_Workers;               ///< Hilos trabajadores
+
+    // ===== SUEÑO / PARADA =====
+    std::mutex m_SleepMutex;          ///< Protege la espera de los trabajadores
+    std::condition_variable m_WakeUp; ///< Señal de trabajo nuevo o de parada
+    std::atomic<size_t> m_QueuedJobs; ///< Trabajos encolados sin empezar
+    std::atomic<bool> m_Stop;         ///< Pide a los trabajadores que terminen
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Bucle de un trabajador
+     */
+    void WorkerLoop(size_t queueIndex);
+
+    /**
+     * @brief Saca un trabajo: primero de la cola propia (final), luego roba (principio)
+     */
+    bool TryPop(size_t homeQueue, std::pair<Job, JobCounter *> &out);
+
+    /**
+     * @brief Ejecuta un trabajo y marca su grupo
+     */
+    static void Execute(std::pair<Job, JobCounter *> &job);
+};
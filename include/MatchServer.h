@@ -0,0 +1,179 @@
+#pragma once
+#include "Game.h"
+#include "ConfigLoader.h"
+#include "AssetLoader.h"
+#include "World.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @struct MatchStats
+ * @brief Resultado de una partida headless
+ */
+struct MatchStats
+{
+    uint32_t matchIndex = 0;       ///< Posición en el lote
+    uint32_t seed = 0;             ///< Semilla del World (reproduce la partida)
+    std::string result;            ///< "game_over", "waves_cleared" o "time_limit"
+    uint64_t ticks = 0;            ///< Ticks simulados
+    float simulatedSeconds = 0.0f; ///< Tiempo de juego simulado
+    double wallSeconds = 0.0;      ///< Tiempo real que costó simularla
+    int waveReached = 0;           ///< Última oleada alcanzada (1-indexed)
+    int totalWaves = 0;            ///< Oleadas configuradas
+    int playerHp = 0;              ///< HP del jugador al terminar
+    int playerMaxHp = 0;           ///< HP máximo del jugador
+    size_t enemiesAlive = 0;       ///< Enemigos vivos al terminar
+    size_t peakEnemies = 0;        ///< Máximo de enemigos vivos a la vez
+    uint64_t stateHash = 0;        ///< Huella del estado final (posiciones, HP, oleada)
+};
+
+/**
+ * @class HeadlessMatch
+ * @brief Una partida sin ventana ni renderer: World, sistemas, RNG y config propios.
+ *
+ * Responsabilidades:
+ * - Crear los sistemas de simulación igual que Game::Initialize (sin Render/HUD/Music)
+ * - Crear el jugador y arrancar las oleadas
+ * - Run(): ticks de paso fijo por SimulationPipeline hasta Game Over, fin de las
+ *   oleadas o el tiempo máximo
+ * - Al terminar resume el estado en MatchStats::stateHash (misma semilla = mismo hash)
+ *
+ * Aislamiento:
+ * - Nada compartido con otras partidas: cada una copia la configuración, tiene su
+ *   AssetLoader headless (no lee archivos) y su World con semilla propia
+ * - Sin JobSystem propio (ctx.jobs = nullptr): el paralelismo está entre partidas
+ *
+ * Input:
+ * - Nadie escribe World::SetKeyboardState, así que el jugador no se mueve ni dispara
+ *   (línea base para balancear oleadas)
+ */
+class HeadlessMatch
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Prepara la partida (sistemas, jugador y primera oleada)
+     * @param config Configuración ya cargada (se copia)
+     * @param seed Semilla del World
+     */
+    HeadlessMatch(const ConfigLoader &config, uint32_t seed);
+
+    /**
+     * @brief Vacía el World antes de que muera el AssetLoader (TextureRef de los sprites)
+     */
+    ~HeadlessMatch();
+
+    HeadlessMatch(const HeadlessMatch &) = delete;
+    HeadlessMatch &operator=(const HeadlessMatch &) = delete;
+
+    // ===== EJECUCIÓN =====
+    /**
+     * @brief Simula la partida hasta que termine
+     * @param maxSimulatedSeconds Tiempo de juego máximo
+     * @return Estadísticas de la partida (matchIndex lo asigna el servidor)
+     */
+    MatchStats Run(float maxSimulatedSeconds);
+
+private:
+    ConfigLoader m_Config;         ///< Copia propia de la configuración
+    uint32_t m_Seed;               ///< Semilla del World
+    float m_FixedDeltaTime;        ///< Duración de un tick (segundos)
+    World m_World;                 ///< Mundo de la partida
+    AssetLoader m_Assets;          ///< Headless: handles sin texturas
+    std::atomic<bool> m_IsRunning; ///< Lo apaga DamageSystem al morir el jugador
+    std::atomic<bool> m_GameOver;  ///< Lo enciende DamageSystem al morir el jugador
+
+    // ===== SISTEMAS =====
+    std::unique_ptr<PlayerInputSystem> m_PlayerInputSystem;             ///< Input (teclado vacío)
+    std::unique_ptr<MovementSystem> m_MovementSystem;                   ///< Aplicar velocidad
+    std::unique_ptr<CollisionSystem> m_CollisionSystem;                 ///< Detectar colisiones
+    std::unique_ptr<CollisionResponseSystem> m_CollisionResponseSystem; ///< Resolver colisiones
+    std::unique_ptr<DamageSystem> m_DamageSystem;                       ///< Sistema de daño
+    std::unique_ptr<EnemyAISystem> m_EnemyAISystem;                     ///< IA de enemigos
+    std::unique_ptr<ProjectileSystem> m_ProjectileSystem;               ///< Disparos del jugador
+    std::unique_ptr<WaveManagerSystem> m_WaveManagerSystem;             ///< Oleadas, spawn y limpieza
+    std::unique_ptr<SimulationPipeline> m_Pipeline;                     ///< Mismo orden que Game en serie
+
+    /**
+     * @brief FNV-1a de oleada, HP y posición/velocidad de jugador y enemigos (bits exactos)
+     */
+    uint64_t HashState();
+};
+
+/**
+ * @class MatchServer
+ * @brief Ejecuta un lote de partidas headless repartidas en un JobSystem.
+ *
+ * Responsabilidades:
+ * - Cargar la configuración JSON una sola vez (cada partida la copia)
+ * - Aplicar la línea de comandos sobre la sección "server" de settings.json
+ * - Una partida = un trabajo: el robo de trabajo reparte partidas de distinta duración
+ * - Informe: resumen por stdout (partidas/s, tiempo simulado/s) y JSON con cada partida
+ *
+ * Comprobación de determinismo (--check-determinism):
+ * - Repite el lote con las mismas semillas (cada partida puede caer en otro hilo)
+ *   y compara resultado, ticks y MatchStats::stateHash partida a partida
+ * - Cualquier diferencia se registra y Run() devuelve false: la misma semilla debe
+ *   dar la misma partida (RNG del mundo, RNG de Wander, orden de los sistemas)
+ *
+ * Sin SDL_Init(VIDEO): no se crea ventana, renderer ni audio.
+ *
+ * Uso:
+ *   main --server [--matches N] [--threads N] [--seed N] [--max-time S] [--out ruta]
+ *                 [--check-determinism]
+ */
+class MatchServer
+{
+public:
+    /**
+     * @brief ¿La línea de comandos pide el modo servidor? (--server)
+     */
+    static bool IsServerMode(int argc, char *argv[]);
+
+    /**
+     * @brief Carga la configuración y aplica los argumentos
+     * @return false si falta algún JSON o un argumento es inválido
+     */
+    bool Initialize(int argc, char *argv[]);
+
+    /**
+     * @brief Ejecuta el lote completo y escribe el informe
+     * @return false si no se pudo escribir el JSON o una partida repetida no coincide
+     */
+    bool Run();
+
+private:
+    ConfigLoader m_Config;                 ///< Configuración base de todas las partidas
+    ConfigLoader::ServerConfig m_Settings; ///< Sección "server" + argumentos
+    std::vector<MatchStats> m_Results;     ///< Una entrada por partida (índice = matchIndex)
+
+    /**
+     * @brief Sobrescribe m_Settings con los argumentos
+     * @return false si un argumento es desconocido o le falta el valor
+     */
+    bool ParseArgs(int argc, char *argv[]);
+
+    /**
+     * @brief Simula todas las partidas del lote (una por trabajo)
+     * @param jobs Pool de hilos (el hilo que espera también ejecuta)
+     * @param results Salida: una entrada por partida
+     */
+    void RunBatch(JobSystem &jobs, std::vector<MatchStats> &results) const;
+
+    /**
+     * @brief Compara m_Results con una repetición del lote
+     * @param rerun Resultados de la segunda pasada (mismas semillas)
+     * @return true si todas las partidas coinciden
+     */
+    bool CompareRuns(const std::vector<MatchStats> &rerun) const;
+
+    /**
+     * @brief Resumen por stdout y JSON en m_Settings.output
+     * @param wallSeconds Tiempo real del lote
+     * @param threads Hilos usados
+     */
+    bool Report(double wallSeconds, size_t threads) const;
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct MovementBatch
+ * @brief Datos empaquetados (SoA) de las entidades dinámicas a mover en un tick.
+ *
+ * Responsabilidades:
+ * - Guardar en arrays contiguos lo que el paso de movimiento necesita
+ * - Reutilizar capacidad entre ticks (Resize no libera memoria)
+ *
+ * Contenido por entidad i:
+ * - posX/posY: Posición (esquina superior izquierda, igual que TransformComponent)
+ * - velX/velY: Velocidad (entrada) y velocidad reflejada en los bordes (salida)
+ * - width/height: Tamaño del collider (0 si no tiene)
+ */
+struct MovementBatch
+{
+    std::vector<float> posX, posY;
+    std::vector<float> velX, velY;
+    std::vector<float> width, height;
+
+    /**
+     * @brief Ajusta el tamaño de todos los arrays
+     * @param count Número de entidades del lote
+     */
+    void Resize(size_t count);
+
+    /**
+     * @brief Número de entidades en el lote
+     */
+    size_t Size() const { return posX.size(); }
+};
+
+/**
+ * @namespace MovementKernel
+ * @brief Integración + confinamiento al rectángulo del mundo en una sola pasada.
+ *
+ * Por cada entidad:
+ * 1. pos += vel * dt
+ * 2. Si pos < 0: pos = 0 y vel = -vel
+ * 3. Si pos + size > mundo: pos = mundo - size y vel = -vel
+ *
+ * Sustituye a los CollisionEvent de borde del mundo: el borde se resuelve aquí,
+ * sin eventos en el heap ni búsquedas por ID.
+ *
+ * Implementaciones:
+ * - StepScalar: Referencia escalar, usada como fallback
+ * - Step: SSE 4 entidades por instrucción (comparaciones + máscaras, sin ramas)
+ *
+ * Ambas producen exactamente el mismo resultado.
+ */
+namespace MovementKernel
+{
+    /**
+     * @brief Referencia escalar del paso de movimiento
+     * @param batch Lote de entidades (pos/vel se modifican)
+     * @param dt Duración del paso (segundos)
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     */
+    void StepScalar(MovementBatch &batch, float dt, float worldWidth, float worldHeight);
+
+    /**
+     * @brief Paso de movimiento vectorizado (SSE si está disponible, si no escalar)
+     * @param batch Lote de entidades (pos/vel se modifican)
+     * @param dt Duración del paso (segundos)
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     */
+    void Step(MovementBatch &batch, float dt, float worldWidth, float worldHeight);
+}
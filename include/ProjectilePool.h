@@ -0,0 +1,101 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @class ProjectilePool
+ * @brief Pool de proyectiles de capacidad fija en formato SoA.
+ *
+ * Responsabilidades:
+ * - Guardar posición, posición previa, velocidad, tiempo de vida y daño por ranura
+ * - Reciclar ranuras con una free list (sin allocations al disparar ni al expirar)
+ * - Integrar y expirar todos los proyectiles en una sola pasada por lote
+ *
+ * Almacenamiento:
+ * - Todos los arrays se reservan con la capacidad en el constructor
+ * - Solo se recorren las ranuras [0, GetHighWater()); las ranuras libres dentro
+ *   de ese rango se integran igual (sin ramas) y se ignoran con IsAlive()
+ * - Expirar también es sin ramas: una máscara apaga m_Alive y, si alguna ranura
+ *   expiró, se reconstruyen la free list y el rango activo en una pasada
+ * - GetHighWater() baja cuando las últimas ranuras quedan libres
+ *
+ * Usado por:
+ * - ProjectileSystem: Dispara, actualiza, colisiona y dibuja los proyectiles
+ */
+class ProjectilePool
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Reserva todas las ranuras
+     * @param capacity Máximo de proyectiles vivos a la vez
+     */
+    explicit ProjectilePool(size_t capacity);
+
+    // ===== CICLO DE VIDA =====
+    /**
+     * @brief Activa un proyectil en una ranura libre
+     * @param x Posición X (centro)
+     * @param y Posición Y (centro)
+     * @param vx Velocidad X (píxeles/segundo)
+     * @param vy Velocidad Y (píxeles/segundo)
+     * @param lifetime Segundos hasta expirar
+     * @param damage Daño al impactar
+     * @return false si el pool está lleno (el disparo se descarta)
+     */
+    bool Spawn(float x, float y, float vx, float vy, float lifetime, int damage);
+
+    /**
+     * @brief Libera una ranura (impacto); no hace nada si ya estaba libre
+     * @param slot Índice de la ranura
+     */
+    void Kill(uint32_t slot);
+
+    /**
+     * @brief Libera todas las ranuras
+     */
+    void Clear();
+
+    // ===== ACTUALIZACIÓN =====
+    /**
+     * @brief Integra (pos += vel * dt) y expira por tiempo o por salir del mundo
+     * @param dt Duración del paso (segundos)
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     *
+     * Guarda la posición previa para el render interpolado.
+     */
+    void Integrate(float dt, float worldWidth, float worldHeight);
+
+    // ===== CONSULTAS =====
+    size_t GetCapacity() const { return m_Alive.size(); }
+    size_t GetActiveCount() const { return m_ActiveCount; }
+    uint32_t GetHighWater() const { return m_HighWater; }
+    bool IsAlive(uint32_t slot) const { return m_Alive[slot] != 0; }
+
+    float GetX(uint32_t slot) const { return m_PosX[slot]; }
+    float GetY(uint32_t slot) const { return m_PosY[slot]; }
+    float GetPreviousX(uint32_t slot) const { return m_PrevX[slot]; }
+    float GetPreviousY(uint32_t slot) const { return m_PrevY[slot]; }
+    int GetDamage(uint32_t slot) const { return m_Damage[slot]; }
+
+private:
+    // ===== DATOS SoA (una entrada por ranura) =====
+    std::vector<float> m_PosX, m_PosY;   ///< Posición actual (centro)
+    std::vector<float> m_PrevX, m_PrevY; ///< Posición del tick anterior
+    std::vector<float> m_VelX, m_VelY;   ///< Velocidad (píxeles/segundo)
+    std::vector<float> m_TimeLeft;       ///< Segundos de vida restantes
+    std::vector<int> m_Damage;           ///< Daño al impactar
+    std::vector<uint8_t> m_Alive;        ///< 1 = ranura ocupada
+
+    // ===== FREE LIST =====
+    std::vector<uint32_t> m_FreeSlots; ///< Pila de ranuras libres (capacidad fija)
+    uint32_t m_HighWater;              ///< 1 + última ranura ocupada
+    size_t m_ActiveCount;              ///< Proyectiles vivos
+
+    /**
+     * @brief Recalcula free list, GetHighWater() y GetActiveCount() a partir de m_Alive
+     */
+    void RebuildFreeSlots();
+};
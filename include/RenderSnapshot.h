@@ -0,0 +1,168 @@
+#pragma once
+#include "AssetLoader.h"
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @enum RenderLayer
+ * @brief Capa de dibujo (orden de pintado de abajo hacia arriba)
+ *
+ * Es el byte alto de la clave de DrawQueue. Dentro de WORLD los sprites se
+ * ordenan por su borde inferior (vista cenital: lo de más abajo tapa a lo de
+ * más arriba); en el resto de capas se agrupan por textura.
+ */
+enum class RenderLayer : uint8_t
+{
+    BACKGROUND,  ///< Fondo de la oleada
+    GROUND,      ///< Decoración plana bajo las entidades (sin orden Y)
+    WORLD,       ///< Jugador, enemigos y obstáculos (orden Y)
+    PROJECTILES  ///< Disparos (encima de las entidades)
+};
+
+/**
+ * @struct SpriteDraw
+ * @brief Un sprite listo para dibujar: no referencia ninguna entidad.
+ */
+struct SpriteDraw
+{
+    TextureHandle texture; ///< Identificador de textura (AssetLoader::Resolve al dibujar)
+    SDL_FRect previous;    ///< Rectángulo en el tick anterior (interpolación)
+    SDL_FRect current;     ///< Rectángulo en el tick actual
+    RenderLayer layer;     ///< Capa de dibujo (SpriteComponent::m_Layer)
+    bool flashHidden;      ///< Fase apagada del parpadeo de invulnerabilidad
+};
+
+/**
+ * @struct ProjectileDraw
+ * @brief Centro de un proyectil en el tick anterior y en el actual
+ */
+struct ProjectileDraw
+{
+    float previousX, previousY;
+    float x, y;
+};
+
+/**
+ * @struct CameraView
+ * @brief Vista de la cámara en el tick anterior y en el actual (coordenadas de mundo)
+ */
+struct CameraView
+{
+    float previousX = 0.0f, previousY = 0.0f; ///< Esquina de la vista en el tick anterior
+    float x = 0.0f, y = 0.0f;                 ///< Esquina de la vista en el tick actual
+    float width = 0.0f, height = 0.0f;        ///< Tamaño de la vista (0 = sin cámara)
+
+    bool IsActive() const { return width > 0.0f && height > 0.0f; }
+
+    /**
+     * @brief Rectángulo que cubre la vista en ambos ticks, ampliado en margin
+     *
+     * Lo que no lo toca no puede aparecer en pantalla con ningún alpha de interpolación.
+     */
+    SDL_FRect SweptBounds(float margin) const;
+};
+
+/**
+ * @struct HudSnapshot
+ * @brief Datos del HUD copiados del jugador
+ */
+struct HudSnapshot
+{
+    bool visible = false; ///< ¿Hay jugador con salud?
+    int hp = 0;           ///< HP actual
+    int maxHp = 0;        ///< HP máximo
+    int wave = 0;         ///< Oleada actual (1-indexed, 0 = sin oleadas)
+    int totalWaves = 0;   ///< Oleadas definidas
+};
+
+/**
+ * @struct RenderSnapshot
+ * @brief Todo lo que necesita un frame de render, copiado del World al final de la simulación.
+ *
+ * El render solo lee esta estructura: nunca toca entidades ni componentes, así que
+ * puede dibujar el frame N mientras la simulación calcula el N+1.
+ */
+struct RenderSnapshot
+{
+    // ===== TIEMPO =====
+    uint64_t frameIndex = 0;        ///< Número de publicación
+    Uint64 publishNs = 0;           ///< SDL_GetTicksNS() al publicar
+    float interpolationSpan = 0.0f; ///< Duración de un tick (0 = sin interpolación)
+    float elapsedTime = 0.0f;       ///< Tiempo de juego (HUD / Game Over)
+
+    // ===== ESTADO =====
+    bool gameOver = false; ///< Dibujar pantalla de Game Over
+
+    // ===== CÁMARA =====
+    CameraView camera; ///< Vista del jugador (sprites y proyectiles ya descartados fuera de ella)
+
+    // ===== CAPAS =====
+    TextureHandle background;                ///< Fondo de la oleada actual
+    std::vector<SpriteDraw> sprites;         ///< En orden de captura (DrawQueue ordena al dibujar)
+    std::vector<SpriteDraw> staticSprites;   ///< Obstáculos bajo las entidades (capa cacheada con el fondo)
+    uint32_t staticVersion = 0;              ///< World::GetObstacleVersion(): cambia al cambiar staticSprites
+    std::vector<ProjectileDraw> projectiles; ///< Proyectiles vivos
+    float projectileWidth = 0.0f;            ///< Ancho común de los proyectiles
+    float projectileHeight = 0.0f;           ///< Alto común de los proyectiles
+    HudSnapshot hud;                         ///< Datos del HUD
+
+    /**
+     * @brief Vacía el snapshot conservando la capacidad de los vectores
+     */
+    void Clear();
+
+    /**
+     * @brief Factor de interpolación para dibujar en el instante nowNs
+     * @return Fracción [0, 1] del tick transcurrida desde la publicación
+     */
+    float InterpolationAt(Uint64 nowNs) const;
+};
+
+/**
+ * @class RenderSnapshotBuffer
+ * @brief Triple buffer de RenderSnapshot entre el hilo de simulación y el de render.
+ *
+ * Responsabilidades:
+ * - Escritura (simulación): BeginWrite() → rellenar → Publish()
+ * - Lectura (render): Acquire() devuelve el snapshot publicado más reciente
+ * - Ninguno de los dos espera al otro: con tres ranuras siempre hay una libre para escribir
+ */
+class RenderSnapshotBuffer
+{
+public:
+    // ===== CONSTRUCTOR =====
+    RenderSnapshotBuffer();
+
+    RenderSnapshotBuffer(const RenderSnapshotBuffer &) = delete;
+    RenderSnapshotBuffer &operator=(const RenderSnapshotBuffer &) = delete;
+
+    // ===== SIMULACIÓN =====
+    /**
+     * @brief Ranura de escritura, ya vacía
+     */
+    RenderSnapshot &BeginWrite();
+
+    /**
+     * @brief Publica la ranura de escritura (sustituye a la publicada no leída)
+     */
+    void Publish();
+
+    // ===== RENDER =====
+    /**
+     * @brief Toma el snapshot más reciente
+     * @return Snapshot a dibujar (nullptr si aún no se publicó ninguno)
+     */
+    const RenderSnapshot *Acquire();
+
+private:
+    RenderSnapshot m_Slots[3]; ///< Escritura / publicada / lectura (los índices rotan)
+    int m_WriteIndex;          ///< Ranura de la simulación
+    int m_ReadyIndex;          ///< Última publicada
+    int m_ReadIndex;           ///< Ranura del render
+    bool m_HasReady;           ///< ¿La publicada aún no se adquirió?
+    bool m_HasRead;            ///< ¿El render tiene algún snapshot?
+    uint64_t m_NextFrame;      ///< Contador de publicaciones
+    std::mutex m_Mutex;        ///< Protege el intercambio de índices
+};
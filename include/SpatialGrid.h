@@ -0,0 +1,95 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @class SpatialGrid
+ * @brief Rejilla uniforme de puntos para consultas de vecindad.
+ *
+ * Responsabilidades:
+ * - Indexar N puntos (índices 0..N-1) por celda
+ * - Responder "¿qué puntos hay a distancia <= radio?" visitando solo celdas cercanas
+ *
+ * Almacenamiento (sin listas enlazadas ni allocations por frame):
+ * - Build() hace counting sort de los puntos por celda
+ * - m_CellStart[c]..m_CellStart[c+1] delimita los índices de la celda c en m_Items
+ * - Los vectores conservan su capacidad entre frames
+ *
+ * Puntos fuera del mundo se asignan a la celda del borde más cercana.
+ *
+ * Usado por:
+ * - EnemyAISystem: Vecinos para separación/cohesión (boids)
+ */
+class SpatialGrid
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Inicializa la rejilla cubriendo el mundo
+     * @param worldWidth Ancho del mundo (píxeles)
+     * @param worldHeight Alto del mundo (píxeles)
+     * @param cellSize Tamaño de celda; idealmente >= radio de consulta
+     */
+    SpatialGrid(float worldWidth, float worldHeight, float cellSize);
+
+    // ===== CONSTRUCCIÓN =====
+    /**
+     * @brief Indexa los puntos (xs[i], ys[i])
+     * @param xs Coordenadas X
+     * @param ys Coordenadas Y
+     * @param count Número de puntos
+     */
+    void Build(const float *xs, const float *ys, size_t count);
+
+    // ===== CONSULTA =====
+    /**
+     * @brief Visita los puntos candidatos en las celdas que cubren el círculo
+     * @param x Centro X
+     * @param y Centro Y
+     * @param radius Radio de búsqueda
+     * @param visit Callback visit(uint32_t index); el llamador filtra por distancia exacta
+     */
+    template <typename Visitor>
+    void Query(float x, float y, float radius, Visitor &&visit) const
+    {
+        const int colMin = ClampCol(x - radius);
+        const int colMax = ClampCol(x + radius);
+        const int rowMin = ClampRow(y - radius);
+        const int rowMax = ClampRow(y + radius);
+
+        for (int row = rowMin; row <= rowMax; ++row)
+        {
+            for (int col = colMin; col <= colMax; ++col)
+            {
+                const int cell = row * m_Cols + col;
+                for (uint32_t i = m_CellStart[cell]; i < m_CellStart[cell + 1]; ++i)
+                    visit(m_Items[i]);
+            }
+        }
+    }
+
+private:
+    // ===== REJILLA =====
+    float m_CellSize; ///< Tamaño de celda (píxeles)
+    int m_Cols;       ///< Número de columnas
+    int m_Rows;       ///< Número de filas
+
+    // ===== ÍNDICE =====
+    std::vector<uint32_t> m_CellStart; ///< Inicio de cada celda en m_Items (tamaño celdas + 1)
+    std::vector<uint32_t> m_Items;     ///< Índices de puntos ordenados por celda
+    std::vector<uint32_t> m_CellOf;    ///< Celda de cada punto (temporal de Build)
+
+    // ===== MÉTODOS PRIVADOS =====
+    int ClampCol(float x) const
+    {
+        return std::clamp(static_cast<int>(std::floor(x / m_CellSize)), 0, m_Cols - 1);
+    }
+
+    int ClampRow(float y) const
+    {
+        return std::clamp(static_cast<int>(std::floor(y / m_CellSize)), 0, m_Rows - 1);
+    }
+};
@@ -0,0 +1,129 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SpriteBatch
+ * @brief Acumula quads en un buffer contiguo y los dibuja con un SDL_RenderGeometry por lote.
+ *
+ * Responsabilidades:
+ * - AddSprite: quad texturizado (textura completa o rectángulo de una página de atlas)
+ * - AddRect / AddOutline: quads de color sólido (HUD, proyectiles)
+ * - AddGeometry: vértices ya maquetados (texto)
+ * - Flush: una llamada SDL_RenderGeometry con todos los quads seguidos de la
+ *   misma textura (nullptr = color sólido con el blend de dibujo del renderer)
+ * - Contadores por frame: llamadas de dibujo emitidas y quads (= llamadas que
+ *   costaría dibujar sin batching)
+ *
+ * Orden:
+ * - Los lotes respetan el orden de llegada: un cambio de textura cierra el lote
+ *   actual (con un atlas, jugador + enemigos + obstáculos caben en un solo lote)
+ *
+ * Modo inmediato (SetEnabled(false)):
+ * - Un flush por quad: referencia para comparar llamadas por frame
+ *
+ * Uso (hilo principal):
+ *   batch.Begin();
+ *   batch.AddSprite(texture, source, dst);
+ *   batch.End();
+ */
+class SpriteBatch
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @param renderer Renderer donde dibujar
+     */
+    explicit SpriteBatch(SDL_Renderer *renderer);
+
+    // ===== FRAME =====
+    /**
+     * @brief Empieza un frame: reinicia los contadores
+     */
+    void Begin();
+
+    /**
+     * @brief Dibuja lo pendiente y cierra el frame
+     */
+    void End();
+
+    /**
+     * @brief Dibuja el lote pendiente (antes de dibujar algo fuera del batch)
+     */
+    void Flush();
+
+    // ===== QUADS =====
+    /**
+     * @brief Añade un quad texturizado
+     * @param texture Textura o página de atlas
+     * @param source Rectángulo origen en píxeles (nullptr = textura completa)
+     * @param dst Rectángulo destino en pantalla
+     */
+    void AddSprite(SDL_Texture *texture, const SDL_FRect *source, const SDL_FRect &dst);
+
+    /**
+     * @brief Añade un rectángulo relleno de color sólido
+     */
+    void AddRect(const SDL_FRect &rect, SDL_FColor color);
+
+    /**
+     * @brief Añade el borde de un rectángulo (4 quads de 1 px, como SDL_RenderRect)
+     */
+    void AddOutline(const SDL_FRect &rect, SDL_FColor color);
+
+    /**
+     * @brief Añade geometría ya construida (p. ej. un TextBlock maquetado)
+     * @param texture Textura de los vértices (UVs ya normalizadas)
+     * @param vertices Vértices (se copian)
+     * @param vertexCount Número de vértices
+     * @param indices Índices relativos a vertices (múltiplo de 6: quads)
+     * @param indexCount Número de índices
+     */
+    void AddGeometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices,
+                     int indexCount);
+
+    // ===== CONFIGURACIÓN =====
+    /**
+     * @brief Activa o desactiva el batching (false = un flush por quad)
+     */
+    void SetEnabled(bool enabled) { m_Enabled = enabled; }
+
+    // ===== ESTADÍSTICAS (del último frame cerrado con End) =====
+    /**
+     * @brief Llamadas de dibujo emitidas en el último frame
+     */
+    uint32_t GetDrawCalls() const { return m_LastDrawCalls; }
+
+    /**
+     * @brief Quads del último frame (llamadas que habría sin batching)
+     */
+    uint32_t GetQuadCount() const { return m_LastQuads; }
+
+private:
+    SDL_Renderer *m_Renderer; ///< Destino del dibujo
+    bool m_Enabled;           ///< false = modo inmediato
+
+    // ===== LOTE ACTUAL =====
+    SDL_Texture *m_Texture;             ///< Textura del lote (nullptr = color sólido)
+    float m_TextureWidth;               ///< Ancho de m_Texture (para normalizar UVs)
+    float m_TextureHeight;              ///< Alto de m_Texture
+    std::vector<SDL_Vertex> m_Vertices; ///< 4 por quad
+    std::vector<int> m_Indices;         ///< 6 por quad
+
+    // ===== CONTADORES =====
+    uint32_t m_DrawCalls;     ///< Llamadas en el frame actual
+    uint32_t m_Quads;         ///< Quads en el frame actual
+    uint32_t m_LastDrawCalls; ///< Llamadas del último frame
+    uint32_t m_LastQuads;     ///< Quads del último frame
+
+    /**
+     * @brief Cambia la textura del lote (cierra el lote si es distinta)
+     */
+    void BindTexture(SDL_Texture *texture);
+
+    /**
+     * @brief Añade los 4 vértices y 6 índices de un quad
+     */
+    void PushQuad(const SDL_FRect &dst, float u0, float v0, float u1, float v1, SDL_FColor color);
+};
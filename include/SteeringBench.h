@@ -0,0 +1,32 @@
+#pragma once
+
+/**
+ * @namespace SteeringBench
+ * @brief Comprobación y medición de SteeringKernel fuera del juego.
+ *
+ * Responsabilidades:
+ * - Generar un lote sintético determinista (enemigos dentro y fuera de rango,
+ *   con dirección de flujo y con persecución directa)
+ * - Comparar un paso de Step contra StepScalar (tolerancia relativa)
+ * - Medir el tiempo por paso de ambos y registrar la aceleración
+ *
+ * Uso:
+ *   main --bench-steering [enemigos] [iteraciones]   (10000 x 1000 por defecto)
+ *
+ * Vive en su propia unidad de compilación: el kernel no depende de SDL ni de spdlog.
+ */
+namespace SteeringBench
+{
+    /**
+     * @brief ¿La línea de comandos pide el benchmark? (--bench-steering)
+     */
+    bool IsBenchmarkMode(int argc, char *argv[]);
+
+    /**
+     * @brief Compara Step contra StepScalar y mide ambos
+     * @param argc Argumentos de main (enemigos e iteraciones opcionales tras --bench-steering)
+     * @param argv Argumentos de main
+     * @return true si Step coincide con la referencia dentro de la tolerancia
+     */
+    bool Run(int argc, char *argv[]);
+}
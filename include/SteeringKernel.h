@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+
+/**
+ * @struct SteeringBatch
+ * @brief Datos empaquetados (SoA) de los enemigos a actualizar en un frame.
+ *
+ * Responsabilidades:
+ * - Guardar en arrays contiguos lo que el paso de persecución necesita
+ * - Reutilizar capacidad entre frames (Resize no libera memoria)
+ *
+ * Contenido por enemigo i:
+ * - posX/posY: Posición (esquina superior izquierda, igual que TransformComponent)
+ * - dirX/dirY: Dirección deseada sin normalizar; (0,0) = persecución directa al jugador
+ * - velX/velY: Velocidad actual (entrada) y suavizada (salida)
+ * - steerX/steerY: Fuerza extra sumada a la velocidad objetivo (px/s, ej: separación)
+ * - speed: baseSpeed del enemigo
+ * - rangeSq: focusRange al cuadrado
+ * - lerp: velocitySmoothing * dt ya limitado a [0, 1]
+ */
+struct SteeringBatch
+{
+    std::vector<float> posX, posY;
+    std::vector<float> dirX, dirY;
+    std::vector<float> velX, velY;
+    std::vector<float> steerX, steerY;
+    std::vector<float> speed;
+    std::vector<float> rangeSq;
+    std::vector<float> lerp;
+
+    /**
+     * @brief Ajusta el tamaño de todos los arrays
+     * @param count Número de enemigos del lote
+     */
+    void Resize(size_t count);
+
+    /**
+     * @brief Número de enemigos en el lote
+     */
+    size_t Size() const { return posX.size(); }
+};
+
+/**
+ * @namespace SteeringKernel
+ * @brief Paso de persecución por lotes para EnemyAISystem.
+ *
+ * Por cada enemigo:
+ * 1. toPlayer = player - pos; dentro de rango si 0.01 < |toPlayer|² <= rangeSq
+ * 2. dir = (dirX, dirY) o toPlayer si es (0,0)
+ * 3. target = normalize(dir) * speed + steer
+ * 4. vel = vel + (target - vel) * lerp   (solo si está en rango)
+ *
+ * Implementaciones:
+ * - StepScalar: Referencia escalar (1/sqrt exacto), usada como fallback
+ * - Step: SSE 4 enemigos por instrucción, máscara para el test de rango y
+ *   _mm_rsqrt_ps + una iteración de Newton para normalizar
+ *
+ * Ambas producen el mismo resultado salvo el error de rsqrt (~1e-6 relativo);
+ * SteeringBench lo comprueba y mide la aceleración (main --bench-steering).
+ */
+namespace SteeringKernel
+{
+    /**
+     * @brief Referencia escalar del paso de persecución
+     * @param batch Lote de enemigos (velX/velY se modifican)
+     * @param playerX Posición X del jugador
+     * @param playerY Posición Y del jugador
+     */
+    void StepScalar(SteeringBatch &batch, float playerX, float playerY);
+
+    /**
+     * @brief Paso de persecución vectorizado (SSE si está disponible, si no escalar)
+     * @param batch Lote de enemigos (velX/velY se modifican)
+     * @param playerX Posición X del jugador
+     * @param playerY Posición Y del jugador
+     */
+    void Step(SteeringBatch &batch, float playerX, float playerY);
+}
@@ -0,0 +1,156 @@
+#pragma once
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+class World;
+
+// Definir ECS_PIPELINE_TIMING (e.g., -DECS_PIPELINE_TIMING) para medir cada etapa
+#ifdef ECS_PIPELINE_TIMING
+constexpr bool PIPELINE_TIMING_ENABLED = true;
+#else
+constexpr bool PIPELINE_TIMING_ENABLED = false;
+#endif
+
+/**
+ * @struct ScopedStageTimer
+ * @brief Suma al acumulador el tiempo entre construcción y destrucción (nanosegundos).
+ *
+ * Con Enabled = false no guarda nada ni llama a SDL_GetTicksNS: desaparece al compilar.
+ */
+template <bool Enabled>
+struct ScopedStageTimer
+{
+    explicit ScopedStageTimer(uint64_t &) {}
+};
+
+template <>
+struct ScopedStageTimer<true>
+{
+    explicit ScopedStageTimer(uint64_t &accumulator)
+        : m_Accumulator(accumulator), m_Start(SDL_GetTicksNS())
+    {
+    }
+
+    ~ScopedStageTimer() { m_Accumulator += SDL_GetTicksNS() - m_Start; }
+
+    ScopedStageTimer(const ScopedStageTimer &) = delete;
+    ScopedStageTimer &operator=(const ScopedStageTimer &) = delete;
+
+private:
+    uint64_t &m_Accumulator; ///< Tiempo total de la etapa
+    Uint64 m_Start;          ///< SDL_GetTicksNS() al entrar
+};
+
+/**
+ * @class SystemPipeline
+ * @brief Secuencia de sistemas fijada en compilación: el orden es la lista de tipos.
+ *
+ * Responsabilidades:
+ * - Guardar los sistemas en un std::tuple (no propietario: Game conserva los unique_ptr)
+ * - Run(): una llamada directa por etapa, Systems::update calificado (sin despacho
+ *   virtual), así el compilador puede expandir el frame entero en línea
+ * - Temporizador por etapa opcional (ECS_PIPELINE_TIMING); sin la macro no cuesta nada
+ *
+ * Relación con SystemScheduler:
+ * - El orden de los tipos es el orden serie de referencia del planificador
+ * - Solo es el camino serie: Game lo usa cuando el planificador sería serie (sin
+ *   trabajadores o force_serial) y MatchServer siempre (una partida por hilo).
+ *   Con trabajadores (lo habitual) corre el DAG del planificador, que mide cada
+ *   sistema con el mismo ScopedStageTimer; LogTimings no registra nada si Run()
+ *   nunca se llamó
+ */
+template <typename... Systems>
+class SystemPipeline
+{
+public:
+    static constexpr size_t STAGE_COUNT = sizeof...(Systems);
+
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Fija los sistemas de cada etapa
+     * @param names Nombre de cada etapa (para LogTimings)
+     * @param systems Sistemas en orden de ejecución (deben vivir más que el pipeline)
+     */
+    SystemPipeline(const std::array<const char *, STAGE_COUNT> &names, Systems &...systems)
+        : m_Systems(&systems...), m_Names(names), m_StageNs{}, m_Ticks(0)
+    {
+    }
+
+    // ===== EJECUCIÓN =====
+    /**
+     * @brief Ejecuta un tick: todas las etapas en orden, en el hilo que llama
+     * @param world Referencia al mundo
+     * @param dt Tiempo transcurrido en segundos
+     */
+    void Run(World &world, float dt)
+    {
+        RunStages(world, dt, std::index_sequence_for<Systems...>{});
+        if constexpr (PIPELINE_TIMING_ENABLED)
+            ++m_Ticks;
+    }
+
+    // ===== RECORRIDO =====
+    /**
+     * @brief Llama a visit(sistema, nombre) por cada etapa, en orden, con el tipo concreto
+     *
+     * Así se registra el mismo orden en SystemScheduler sin repetir la lista.
+     */
+    template <typename Visitor>
+    void ForEach(Visitor &&visit)
+    {
+        VisitStages(visit, std::index_sequence_for<Systems...>{});
+    }
+
+    // ===== TIEMPOS =====
+    /**
+     * @brief Tiempo total acumulado por una etapa (0 si ECS_PIPELINE_TIMING no está definida)
+     */
+    uint64_t GetStageNs(size_t stage) const { return m_StageNs[stage]; }
+
+    /**
+     * @brief Registra el tiempo medio por tick de cada etapa (no hace nada sin ECS_PIPELINE_TIMING)
+     */
+    void LogTimings() const
+    {
+        if constexpr (PIPELINE_TIMING_ENABLED)
+        {
+            if (m_Ticks == 0)
+                return;
+
+            for (size_t i = 0; i < STAGE_COUNT; ++i)
+                spdlog::info("Pipeline: {} {:.3f} ms/tick", m_Names[i], m_StageNs[i] / 1e6 / m_Ticks);
+        }
+    }
+
+private:
+    std::tuple<Systems *...> m_Systems;            ///< Etapas en orden de ejecución
+    std::array<const char *, STAGE_COUNT> m_Names; ///< Nombre de cada etapa
+    std::array<uint64_t, STAGE_COUNT> m_StageNs;   ///< Tiempo acumulado por etapa
+    uint64_t m_Ticks;                              ///< Ticks medidos
+
+    template <typename Visitor, size_t... I>
+    void VisitStages(Visitor &visit, std::index_sequence<I...>)
+    {
+        (visit(*std::get<I>(m_Systems), m_Names[I]), ...);
+    }
+
+    template <size_t... I>
+    void RunStages(World &world, float dt, std::index_sequence<I...>)
+    {
+        (RunStage<I>(world, dt), ...);
+    }
+
+    template <size_t I>
+    void RunStage(World &world, float dt)
+    {
+        using System = std::tuple_element_t<I, std::tuple<Systems...>>;
+
+        ScopedStageTimer<PIPELINE_TIMING_ENABLED> timer(m_StageNs[I]);
+        // Llamada calificada: enlaza System::update directamente, sin vtable
+        std::get<I>(m_Systems)->System::update(world, dt);
+    }
+};
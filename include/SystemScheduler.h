@@ -0,0 +1,150 @@
+#pragma once
+#include "ISystem.h"
+#include "JobSystem.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class World;
+
+/**
+ * @class SystemScheduler
+ * @brief Ejecuta los sistemas de simulación respetando sus dependencias de datos.
+ *
+ * Responsabilidades:
+ * - Guardar los sistemas en su orden serie (orden de Add)
+ * - Add es plantilla: cada nodo guarda una función que llama a System::update
+ *   calificado, así ni el camino serie ni los trabajos pasan por la vtable
+ * - Cada frame, construir el DAG a partir de ISystem::access(): i -> j (i < j)
+ *   si i y j están en conflicto (uno escribe algo que el otro lee o escribe)
+ * - Lanzar en JobSystem los sistemas cuyas dependencias ya terminaron
+ * - Ejecutar en el hilo que llama a Run() los que declaran SystemResource::MAIN_THREAD
+ *
+ * Equivalencia con el orden serie:
+ * - Todo par en conflicto conserva el orden de registro; los pares sin conflicto
+ *   no comparten datos, así que el resultado es el mismo que ejecutarlos en serie
+ * - Tras un sistema que escribe ENTITIES se reconstruyen las caches de World
+ *   (GetEnemies/GetObstacles) antes de liberar a los siguientes, para que nunca
+ *   se reconstruyan desde dos hilos a la vez
+ *
+ * Depuración:
+ * - SetForceSerial(true) ejecuta todo en orden de registro en el hilo que llama a Run()
+ * - Con ECS_PIPELINE_TIMING mide cada sistema con el mismo ScopedStageTimer que
+ *   SystemPipeline (en paralelo los tiempos se solapan: su suma supera el tick)
+ */
+class SystemScheduler
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Crea el planificador sobre un JobSystem
+     * @param jobs Pool de hilos (en modo serie, el planificador también es serie)
+     */
+    explicit SystemScheduler(JobSystem &jobs);
+
+    // ===== REGISTRO =====
+    /**
+     * @brief Agrega un sistema al final del orden serie
+     * @tparam System Tipo concreto (su update se enlaza directamente, sin vtable)
+     * @param system Sistema (no propietario; debe vivir más que el planificador)
+     * @param name Nombre para logs
+     */
+    template <typename System>
+    void Add(System &system, const std::string &name)
+    {
+        static_assert(std::is_base_of_v<ISystem, System> && !std::is_abstract_v<System>,
+                      "SystemScheduler::Add necesita el tipo concreto del sistema");
+        AddNode(system, name, &UpdateStage<System>);
+    }
+
+    /**
+     * @brief Fuerza ejecución serie (depuración)
+     */
+    void SetForceSerial(bool forceSerial) { m_ForceSerial = forceSerial; }
+
+    /**
+     * @brief ¿Run() ejecutaría todo en serie? (forzado o JobSystem sin trabajadores)
+     */
+    bool IsSerial() const { return m_ForceSerial || m_Jobs.IsSerial(); }
+
+    // ===== EJECUCIÓN =====
+    /**
+     * @brief Ejecuta un tick de todos los sistemas
+     * @param world Referencia al mundo
+     * @param dt Tiempo transcurrido en segundos
+     */
+    void Run(World &world, float dt);
+
+    /**
+     * @brief Construye el DAG con las declaraciones actuales y lo registra en el log
+     */
+    void LogGraph();
+
+    /**
+     * @brief Registra el tiempo medio por tick de cada sistema (no hace nada sin ECS_PIPELINE_TIMING)
+     */
+    void LogTimings() const;
+
+private:
+    // ===== NODOS =====
+    using UpdateFn = void (*)(ISystem &, World &, float);
+
+    struct Node
+    {
+        ISystem *system;
+        UpdateFn update;                  ///< System::update calificado (ver UpdateStage)
+        std::string name;
+        SystemAccess access;              ///< Declaración del frame actual
+        std::vector<uint32_t> successors; ///< Sistemas que esperan a este
+        uint32_t dependencyCount;         ///< Predecesores directos
+        uint64_t stageNs;                 ///< Tiempo acumulado (ECS_PIPELINE_TIMING)
+    };
+
+    JobSystem &m_Jobs;                                    ///< Pool de hilos
+    std::vector<Node> m_Nodes;                            ///< En orden serie
+    std::unique_ptr<std::atomic<uint32_t>[]> m_Remaining; ///< Predecesores pendientes (por frame)
+    bool m_ForceSerial;                                   ///< Ejecutar en serie
+    uint64_t m_Ticks;                                     ///< Ticks medidos (ECS_PIPELINE_TIMING)
+
+    // ===== ESTADO DEL FRAME =====
+    World *m_World;                    ///< Mundo del Run() actual
+    float m_Dt;                        ///< dt del Run() actual
+    JobCounter m_FrameJobs;            ///< Trabajos lanzados este frame
+    std::atomic<uint32_t> m_Completed; ///< Sistemas terminados este frame
+    std::mutex m_MainReadyMutex;       ///< Protege m_MainReady
+    std::vector<uint32_t> m_MainReady; ///< Listos que requieren el hilo de Run()
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Llamada calificada: enlaza System::update directamente, como SystemPipeline
+     */
+    template <typename System>
+    static void UpdateStage(ISystem &system, World &world, float dt)
+    {
+        static_cast<System &>(system).System::update(world, dt);
+    }
+
+    /**
+     * @brief Guarda el nodo (parte no plantilla de Add)
+     */
+    void AddNode(ISystem &system, const std::string &name, UpdateFn update);
+
+    /**
+     * @brief Relee access() de cada sistema y reconstruye las aristas
+     */
+    void BuildGraph();
+
+    /**
+     * @brief Lanza un nodo listo (JobSystem o cola del hilo de Run())
+     */
+    void Dispatch(uint32_t node);
+
+    /**
+     * @brief Ejecuta un nodo y libera a sus sucesores
+     */
+    void Execute(uint32_t node);
+};
@@ -4,6 +4,8 @@
 
 // Declaración forward de GameContext (se define en Game.h)
 struct GameContext;
+class Entity;
+class TransformComponent;
 
 /**
  * @class CollisionResponseSystem
@@ -12,15 +14,18 @@ struct GameContext;
  * Responsabilidades:
  * - Procesa CollisionEvent emitidos por CollisionSystem
  * - Aplica respuestas físicas: push/bounce para evitar solapamiento
- * - Confina entidades dentro de los límites del mundo
  *
  * Respuestas por tipo de colisión:
  * - PLAYER_ENEMY: Ambas entidades se empujan (playerPush, enemyPush)
  * - ENEMY_ENEMY: Se empujan mutuamente
- * - ENTITY_WORLD: Se desplazan hacia dentro del mundo
  * - PLAYER_OBSTACLE: Jugador se empuja fuera del obstáculo
  * - ENEMY_OBSTACLE: Enemigo se empuja fuera del obstáculo
  *
+ * Bordes del mundo:
+ * - MovementSystem integra y confina (rebote en el borde)
+ * - Los empujes llegan después, así que cada entidad empujada se vuelve a confinar
+ *   aquí: la última escritura de posición del tick siempre queda dentro del mundo
+ *
  * Parámetros:
  * - playerPushStrength: Fuerza con que el jugador empuja a otros
  * - enemyPushStrength: Fuerza con que los enemigos se empujan entre sí
@@ -45,10 +50,27 @@ public:
      */
     void update(World &world, float dt) override;
 
+    /**
+     * @brief Recursos para SystemScheduler (Consume CollisionEvent y empuja entidades)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::OBSTACLES | SystemResource::EVENTS,
+                SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::EVENTS};
+    }
+
 private:
     // ===== PARÁMETROS FÍSICOS =====
     float m_PlayerPushStrength; ///< Fuerza de empuje del jugador
     float m_EnemyPushStrength;  ///< Fuerza de empuje entre enemigos
-    float m_WorldWidth;         ///< Ancho del mundo (para confinar)
-    float m_WorldHeight;        ///< Alto del mundo (para confinar)
+    float m_WorldWidth;         ///< Ancho del mundo (para confinar tras empujar)
+    float m_WorldHeight;        ///< Alto del mundo (para confinar tras empujar)
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Devuelve al mundo una entidad empujada fuera (solo posición; la velocidad ya la fijó el empuje)
+     * @param entity Entidad empujada (su collider da el tamaño)
+     * @param transform Transform de la entidad
+     */
+    void confine(Entity *entity, TransformComponent *transform) const;
 };
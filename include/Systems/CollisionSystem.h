@@ -2,9 +2,13 @@
 #include "../ISystem.h"
 #include "../World.h"
 #include <glm/glm.hpp>
+#include <vector>
 
 // Declaración forward de GameContext (se define en Game.h)
 struct GameContext;
+class JobSystem;
+class TransformComponent;
+class ColliderComponent;
 
 /**
  * @class CollisionSystem
@@ -18,9 +22,18 @@ struct GameContext;
  * Tipos de colisiones detectadas:
  * - PLAYER_ENEMY: Jugador toca enemigo
  * - ENEMY_ENEMY: Dos enemigos se tocan
- * - ENTITY_WORLD: Entidad toca borde del mundo
  * - PLAYER_OBSTACLE: Jugador toca obstáculo estático
  * - ENEMY_OBSTACLE: Enemigo toca obstáculo estático
+ *
+ * Los bordes del mundo NO se detectan aquí: MovementSystem integra y confina
+ * en la misma pasada (MovementKernel), sin eventos.
+ *
+ * ENEMY_OBSTACLE usa World::GetObstacleField() como descarte temprano:
+ * solo los enemigos cerca de algún obstáculo recorren la lista de obstáculos.
+ *
+ * ENEMY_ENEMY (O(n²)) se reparte en JobSystem::ParallelFor por bloques de filas
+ * con igual número de pares; cada bloque guarda sus colisiones y se emiten en
+ * orden de bloque, así la cola de eventos queda igual que en serie.
  */
 class CollisionSystem : public ISystem
 {
@@ -40,10 +53,34 @@ public:
      */
     void update(World &world, float dt) override;
 
+    /**
+     * @brief Recursos para SystemScheduler (Solo detecta: emite CollisionEvent)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::OBSTACLES,
+                SystemResource::EVENTS};
+    }
+
 private:
-    // ===== CONTEXTO =====
-    float m_WorldWidth;  ///< Ancho del mundo (1920 píxeles)
-    float m_WorldHeight; ///< Alto del mundo (1080 píxeles)
+    // ===== PARALELISMO =====
+    /**
+     * @struct EnemyPairHit
+     * @brief Colisión enemigo-enemigo pendiente de emitir
+     */
+    struct EnemyPairHit
+    {
+        uint32_t idA;
+        uint32_t idB;
+        glm::vec2 pushDirection;
+    };
+
+    JobSystem *m_Jobs;                                  ///< Pool de hilos (nullptr = serie)
+    std::vector<Entity *> m_PairEntities;               ///< Enemigos con transform + collider
+    std::vector<TransformComponent *> m_PairTransforms; ///< Transform de cada uno
+    std::vector<ColliderComponent *> m_PairColliders;   ///< Collider de cada uno
+    std::vector<size_t> m_RowStart;                     ///< Primera fila de cada bloque
+    std::vector<std::vector<EnemyPairHit>> m_BlockHits; ///< Colisiones por bloque (capacidad reutilizada)
 
     // ===== MÉTODOS PRIVADOS =====
     /**
@@ -54,8 +91,8 @@ private:
      * @param size2 Tamaño del segundo rectángulo
      * @return true si hay solapamiento en X e Y
      */
-    bool checkAABBCollision(const glm::vec2 &pos1, const glm::vec2 &size1,
-                            const glm::vec2 &pos2, const glm::vec2 &size2);
+    static bool checkAABBCollision(const glm::vec2 &pos1, const glm::vec2 &size1,
+                                   const glm::vec2 &pos2, const glm::vec2 &size2);
 
     /**
      * @brief Detecta colisiones jugador-enemigo
@@ -69,12 +106,6 @@ private:
      */
     void checkEnemyEnemyCollisions(World &world);
 
-    /**
-     * @brief Detecta colisiones con bordes del mundo
-     * @param world Referencia al mundo
-     */
-    void checkWorldBoundaries(World &world);
-
     /**
      * @brief Detecta colisiones jugador-obstáculo
      * @param world Referencia al mundo
@@ -1,14 +1,16 @@
 #pragma once
 #include "../ISystem.h"
 #include "../World.h"
+#include <atomic>
 
 /**
  * @class DamageSystem
  * @brief Gestiona daño, invulnerabilidad y muerte.
  *
  * Responsabilidades:
- * - Procesa CollisionEvent tipo PLAYER_ENEMY
+ * - Procesa DamageEvent (jugador: CollisionResponseSystem; enemigos: ProjectileSystem)
  * - Aplica daño al jugador
+ * - Elimina enemigos impactados (sin HealthComponent mueren al primer golpe)
  * - Activa invulnerabilidad temporal
  * - Verifica muerte del jugador y termina el juego
  *
@@ -26,8 +28,8 @@ class DamageSystem : public ISystem
 {
 private:
     // ===== PUNTEROS A ESTADO DEL JUEGO =====
-    bool *m_GameRunning; ///< Puntero a flag de juego activo (termina si false)
-    bool *m_GameOver;    ///< Puntero a flag de Game Over (jugador muere)
+    std::atomic<bool> *m_GameRunning; ///< Puntero a flag de juego activo (termina si false)
+    std::atomic<bool> *m_GameOver;    ///< Puntero a flag de Game Over (jugador muere; lo lee el render)
 
     // ===== PARÁMETROS DE DAÑO =====
     float m_PlayerInvulnerabilityDuration; ///< Duración de invulnerabilidad (segundos)
@@ -40,7 +42,7 @@ public:
      * @param gameOver Puntero a flag de Game Over
      * @param invulnerabilityDuration Duración de invulnerabilidad tras daño (ej: 1.0)
      */
-    DamageSystem(bool *gameRunning, bool *gameOver, float invulnerabilityDuration);
+    DamageSystem(std::atomic<bool> *gameRunning, std::atomic<bool> *gameOver, float invulnerabilityDuration);
 
     // ===== INTERFAZ ISystem =====
     /**
@@ -49,4 +51,14 @@ public:
      * @param dt Tiempo transcurrido en segundos
      */
     void update(World &world, float dt) override;
+
+    /**
+     * @brief Recursos para SystemScheduler (Elimina enemigos; sus TextureRef se sueltan en AssetLoader)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::EVENTS,
+                SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::EVENTS |
+                SystemResource::ENTITIES | SystemResource::GAME_STATE};
+    }
 };
@@ -1,6 +1,20 @@
 #pragma once
 #include "../ISystem.h"
 #include "../World.h"
+#include "../ConfigLoader.h"
+#include "../FlowField.h"
+#include "../SteeringKernel.h"
+#include "../SpatialGrid.h"
+#include "../BehaviorTable.h"
+#include <array>
+#include <vector>
+
+// Declaración forward de GameContext (se define en Game.h)
+struct GameContext;
+class JobSystem;
+class EnemyComponent;
+class TransformComponent;
+class ColliderComponent;
 
 /**
  * @class EnemyAISystem
@@ -12,9 +26,11 @@
  * - Suavizar cambios de velocidad (Lerp) para movimiento natural
  *
  * Algoritmo de IA:
+ * 0. Actualizar FlowField (solo si el jugador cambió de celda o cambiaron obstáculos)
  * 1. Para cada enemigo:
  *    a. Calcular distancia al jugador
- *    b. Si distancia < focusRange: perseguir
+ *    b. Si distancia < focusRange: perseguir siguiendo el FlowField
+ *       (persecución directa si está en la celda del jugador o es inalcanzable)
  *    c. Si distancia >= focusRange: deambular o quieto
  * 2. Suavizar velocidad usando Lerp: vel = Lerp(vel_actual, vel_deseada, smoothing)
  * 3. Asignar velocidad a TransformComponent
@@ -24,18 +40,174 @@
  * - focusRange: Rango de persecución (ej: 400-500 px)
  * - velocitySmoothing: Factor Lerp (0.1-1.0, mayor = cambio más rápido)
  *
- * Comportamiento:
- * - Persecución: Se mueve hacia el jugador dentro del rango
- * - Fuera de rango: Velocidad se suaviza a cero (deambula lentamente)
+ * Comportamiento (máquinas de estados de BehaviorTable):
+ * - Cada tipo declara estados (chase, wander, flee, orbit, dash, idle) y transiciones en JSON
+ * - Sin "behavior": un único estado chase (persecución dentro de focusRange)
+ * - Por frame: evaluar transiciones de los enemigos seleccionados, agruparlos por
+ *   acción (counting sort) y ejecutar un bucle compacto por acción
+ *   (sin virtuales ni switch por enemigo)
+ * - Chase usa FlowField + SteeringKernel; el resto calcula la velocidad objetivo directamente
+ *
+ * LOD de IA (nivel de detalle):
+ * - Cercanos (distancia <= lodNearDistance): se actualizan cada frame
+ * - Lejanos: se actualizan en rodajas round-robin (~1/lodFarInterval por frame)
+ * - Cada enemigo acumula su dt en EnemyComponent::aiAccumulatedTime, de modo que
+ *   una actualización tardía aplica el tiempo real transcurrido
+ * - maxUpdatesPerFrame limita solo la rodaja de lejanos: los cercanos se actualizan
+ *   siempre y consumen el presupuesto primero (con muchos cercanos, 1 lejano por frame)
+ * - El coste crece con los enemigos cercanos, no con el total de la oleada
+ *
+ * Separación / cohesión (boids):
+ * - Cada frame se indexan los centros de todos los enemigos en una SpatialGrid
+ *   (celda = separationRadius, solo se consultan las 3x3 celdas vecinas)
+ * - Separación: suma de (yo - vecino) / d * (1 - d / radio), limitada a longitud 1
+ * - Cohesión (opcional): dirección hacia el centro medio de los vecinos
+ * - La fuerza se escala por baseSpeed y se suma a la velocidad objetivo antes del Lerp,
+ *   así la multitud evita solaparse en lugar de resolver el choque después
+ *   (menos contactos ENEMY_ENEMY en CollisionSystem)
+ *
+ * Evitación de obstáculos (SDF):
+ * - World::GetObstacleField() se construye al iniciar la fase
+ * - holgura = SDF(centro) - radio del enemigo; si holgura < obstacleAvoidDistance
+ *   se empuja siguiendo el gradiente, proporcional a (1 - holgura / distancia)
+ * - Una consulta O(1) por enemigo, independiente del número de obstáculos
+ *
+ * Ejecución por lotes:
+ * - Los punteros a componentes se cachean por enemigo y solo se reconstruyen
+ *   cuando cambia World::GetEnemyVersion() (sin GetComponent por frame)
+ * - Los enemigos seleccionados se empaquetan en un SteeringBatch (SoA)
+ *   y se procesan con SteeringKernel::Step (SSE, 4 enemigos por instrucción)
+ * - La fuerza de dirección (separación + evitación) del lote es de solo lectura
+ *   por enemigo y se calcula con JobSystem::ParallelFor
  */
 class EnemyAISystem : public ISystem
 {
+private:
+    // ===== PATHFINDING =====
+    ConfigLoader::AIConfig m_Config; ///< Parámetros de IA (settings.json)
+    FlowField m_FlowField;           ///< Campo de flujo compartido hacia el jugador
+    uint32_t m_ObstacleVersion;      ///< Versión de obstáculos usada en el último SetObstacles
+    bool m_HasObstacleLayout;        ///< ¿Se cargó algún layout en el FlowField?
+
+    // ===== CACHÉ DE COMPONENTES =====
+    /**
+     * @struct Agent
+     * @brief Punteros cacheados a los componentes de un enemigo
+     */
+    struct Agent
+    {
+        EnemyComponent *ai;
+        TransformComponent *transform;
+        ColliderComponent *collider; ///< Puede ser nullptr
+    };
+    std::vector<Agent> m_Agents; ///< Un Agent por enemigo válido (mismo orden que World::GetEnemies)
+    uint32_t m_EnemyVersion;     ///< Versión de enemigos usada para construir m_Agents
+    bool m_HasAgents;            ///< ¿Se construyó m_Agents al menos una vez?
+
+    // ===== LOD =====
+    size_t m_LodCursor;                      ///< Posición round-robin en m_Agents para los lejanos
+    std::vector<uint8_t> m_SelectedThisFrame; ///< 1 = Agent ya seleccionado como cercano este frame
+
+    // ===== SEPARACIÓN =====
+    SpatialGrid m_NeighborGrid;   ///< Rejilla de vecinos (reconstruida cada frame)
+    std::vector<float> m_CenterX; ///< Centro X de cada Agent (mismo orden que m_Agents)
+    std::vector<float> m_CenterY; ///< Centro Y de cada Agent
+
+    // ===== MÁQUINAS DE ESTADOS =====
+    BehaviorTable m_Behaviors;             ///< Estados/transiciones compilados de todos los tipos
+    std::vector<uint32_t> m_Selected;      ///< Agents a actualizar este frame (cercanos + rodaja)
+    std::vector<float> m_SelectedDt;       ///< dt acumulado consumido por cada seleccionado
+    std::vector<uint32_t> m_ActionOrder;   ///< Índices en m_Selected ordenados por acción
+    std::array<uint32_t, static_cast<size_t>(BehaviorAction::Count) + 1> m_ActionStart; ///< Rango de cada acción en m_ActionOrder
+    uint32_t m_RngState;                   ///< Estado xorshift para Wander (SeedRng)
+
+    // ===== OBSTÁCULOS =====
+    const DistanceField *m_ObstacleField; ///< SDF usado en el update() actual (nullptr = sin evitación)
+
+    // ===== LOTE =====
+    SteeringBatch m_Batch;              ///< Datos SoA del frame (capacidad reutilizada)
+    std::vector<uint32_t> m_BatchAgent; ///< Índice en m_Agents de cada entrada del lote
+
+    // ===== PARALELISMO =====
+    JobSystem *m_Jobs; ///< Pool de hilos para ParallelFor (nullptr = serie)
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Reconstruye m_Agents si cambió el conjunto de enemigos
+     * @param world Referencia al mundo
+     */
+    void refreshAgents(World &world);
+
+    /**
+     * @brief Marca un enemigo para actualizar este frame y consume su dt acumulado
+     * @param agentIndex Índice en m_Agents
+     */
+    void selectAgent(uint32_t agentIndex);
+
+    /**
+     * @brief Evalúa transiciones de los seleccionados y los agrupa por acción
+     * @param playerPosition Posición del jugador
+     */
+    void runTransitions(const glm::vec2 &playerPosition);
+
+    /**
+     * @brief Agrega un enemigo en estado Chase al lote del SteeringKernel
+     * @param selectedIndex Índice en m_Selected
+     */
+    void enqueueChase(uint32_t selectedIndex);
+
+    /**
+     * @brief Bucle de una acción distinta de Chase (la acción se resuelve en compilación)
+     * @tparam Action Acción del grupo (Wander, Flee, Orbit, Dash, Idle)
+     * @param playerPosition Posición del jugador
+     */
+    template <BehaviorAction Action>
+    void runAction(const glm::vec2 &playerPosition);
+
+    /**
+     * @brief Número aleatorio uniforme en [-1, 1] (xorshift32)
+     */
+    float nextSigned();
+
+    /**
+     * @brief Calcula la fuerza de separación/cohesión de un enemigo
+     * @param agentIndex Índice en m_Agents
+     * @return Fuerza en px/s (ya escalada por baseSpeed)
+     */
+    glm::vec2 computeSeparation(uint32_t agentIndex) const;
+
+    /**
+     * @brief Calcula la fuerza de evitación de obstáculos (gradiente del SDF)
+     * @param agentIndex Índice en m_Agents
+     * @param field Campo de distancia de la fase actual
+     * @return Fuerza en px/s (ya escalada por baseSpeed)
+     */
+    glm::vec2 computeAvoidance(uint32_t agentIndex, const DistanceField &field) const;
+
+    /**
+     * @brief Suma de separación + evitación según la configuración
+     * @param agentIndex Índice en m_Agents
+     */
+    glm::vec2 computeSteer(uint32_t agentIndex) const;
+
 public:
     // ===== CONSTRUCTOR =====
     /**
      * @brief Inicializa el sistema de IA
+     * @param ctx Contexto del juego (dimensiones del mundo para la rejilla)
+     * @param config Parámetros de IA (campo de flujo, LOD, separación)
+     * @param behaviors Máquinas de estados compiladas (ConfigLoader::EnemyEntityConfig)
      */
-    EnemyAISystem();
+    EnemyAISystem(const GameContext &ctx, const ConfigLoader::AIConfig &config, const BehaviorTable &behaviors);
+
+    /**
+     * @brief Siembra el RNG de Wander desde el del mundo (tras World::SeedRng)
+     *
+     * Así una partida con la misma semilla repite también los giros de Wander.
+     *
+     * @param world Mundo ya sembrado (consume un número de su RNG)
+     */
+    void SeedRng(World &world);
 
     // ===== INTERFAZ ISystem =====
     /**
@@ -44,4 +216,13 @@ public:
      * @param dt Tiempo transcurrido en segundos (usado para Lerp)
      */
     void update(World &world, float dt) override;
+
+    /**
+     * @brief Recursos para SystemScheduler (Lee jugador y obstáculos, escribe enemigos)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::OBSTACLES,
+                SystemResource::ENEMIES};
+    }
 };
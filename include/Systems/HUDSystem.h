@@ -1,9 +1,14 @@
 #pragma once
 #include "../ISystem.h"
 #include "../World.h"
+#include "../RenderSnapshot.h"
+#include "../CachedLayer.h"
+#include "../BitmapFont.h"
 #include <SDL3/SDL.h>
 #include <string>
 
+class SpriteBatch;
+
 // Declaración forward de GameContext (se define en Game.h)
 struct GameContext;
 
@@ -19,11 +24,18 @@ struct GameContext;
  *
  * Información mostrada:
  * - Tiempo jugado en segundos
- * - Puntos de vida del jugador (ej: "HP: 8/10")
- * - Estado de oleada actual (futuro)
+ * - Puntos de vida del jugador (ej: "8/10")
+ * - Oleada actual / total
+ * - FPS y tiempo de frame medio (esquina superior derecha)
  *
- * Renderizado:
- * - Utiliza SDL3 para dibujar texto y rectángulos
+ * Captura / dibujo:
+ * - update() (hilo de simulación) copia HP del jugador al RenderSnapshot asignado
+ * - Draw() (hilo principal) dibuja solo a partir del snapshot
+ * - Los rectángulos y bordes van al SpriteBatch (un solo lote de color sólido)
+ * - Panel y cajas se dibujan en un CachedLayer solo cuando cambia hp/maxHp;
+ *   el resto de frames el panel es un único quad
+ * - Texto con BitmapFont: cada TextBlock solo se remaqueta si su texto cambió,
+ *   y todos comparten la textura del atlas (un lote para todo el texto)
  * - Colores: Blanco para texto, Rojo para barras de daño
  * - Posicionado en esquinas de la pantalla
  *
@@ -35,17 +47,44 @@ class HUDSystem : public ISystem
 private:
     // ===== CONTEXTO SDL =====
     SDL_Renderer *m_Renderer; ///< Contexto de renderizado SDL3
-    float m_WorldWidth;       ///< Ancho para posicionar HUD
-    float m_WorldHeight;      ///< Alto para posicionar HUD
+    SpriteBatch *m_Batch;     ///< Lotes de quads (panel, cajas y bordes en una llamada)
+    float m_ScreenWidth;      ///< Ancho de la ventana (el HUD no sigue a la cámara)
+    float m_ScreenHeight;     ///< Alto de la ventana
+
+    // ===== CAPTURA =====
+    RenderSnapshot *m_Snapshot; ///< Destino de la próxima captura (no propietario)
+
+    // ===== DIBUJO =====
+    CachedLayer m_PanelLayer; ///< Panel + cajas de HP (se regenera al cambiar hp/maxHp)
+    bool m_CacheLayers;       ///< false = el panel se dibuja cada frame
+
+    // ===== TEXTO =====
+    BitmapFont m_Font;      ///< Atlas de glifos (se crea una vez en el constructor)
+    TextBlock m_HpText;     ///< "8/10" junto a las cajas
+    TextBlock m_StatusText; ///< Oleada y tiempo
+    TextBlock m_FpsText;    ///< FPS y tiempo de frame (esquina superior derecha)
+
+    // ===== FPS (medido en Draw, hilo principal) =====
+    Uint64 m_FpsWindowStartNs; ///< Inicio de la ventana de medida
+    Uint64 m_LastDrawNs;       ///< Draw() anterior
+    int m_FpsFrames;           ///< Frames en la ventana
+    double m_FrameTimeSumMs;   ///< Suma de tiempos de frame en la ventana
+    char m_FpsLabel[32];       ///< Última lectura (cambia cada FPS_REFRESH_SECONDS)
 
     // ===== MÉTODOS PRIVADOS =====
     /**
-     * @brief Renderiza texto en pantalla (interfaz futura)
+     * @brief Renderiza texto en pantalla con la fuente de mapa de bits
+     * @param block Bloque que conserva la maquetación entre frames
      * @param text Texto a renderizar
      * @param x Posición X
      * @param y Posición Y
      */
-    void renderText(const std::string &text, int x, int y);
+    void renderText(TextBlock &block, const char *text, int x, int y);
+
+    /**
+     * @brief Cuenta el frame y refresca m_FpsLabel cada FPS_REFRESH_SECONDS
+     */
+    void UpdateFps();
 
     /**
      * @brief Renderiza un rectángulo de color
@@ -60,6 +99,12 @@ private:
      */
     void renderRectangle(int x, int y, int width, int height, int r, int g, int b, int a = 255);
 
+    /**
+     * @brief Dibuja el panel y las cajas de HP en el destino actual del batch
+     * @param hud HP a representar
+     */
+    void DrawPanel(const HudSnapshot &hud);
+
 public:
     // ===== CONSTRUCTOR =====
     /**
@@ -70,9 +115,33 @@ public:
 
     // ===== INTERFAZ ISystem =====
     /**
-     * @brief Renderiza HUD en pantalla
+     * @brief Captura los datos del HUD en el snapshot asignado
      * @param world Referencia al mundo (para obtener jugador)
      * @param dt Tiempo transcurrido en segundos
      */
     void update(World &world, float dt) override;
+
+    // ===== CAPTURA =====
+    /**
+     * @brief Asigna el snapshot que rellenará el próximo update()
+     * @param snapshot Ranura de escritura del RenderSnapshotBuffer
+     */
+    void SetSnapshot(RenderSnapshot *snapshot) { m_Snapshot = snapshot; }
+
+    // ===== DIBUJO =====
+    /**
+     * @brief Renderiza HUD en pantalla
+     * @param snapshot Snapshot adquirido por el render
+     */
+    void Draw(const RenderSnapshot &snapshot);
+
+    /**
+     * @brief Activa o desactiva la capa cacheada del panel
+     */
+    void SetLayerCaching(bool enabled) { m_CacheLayers = enabled; }
+
+    /**
+     * @brief Fuerza a regenerar la capa cacheada (render targets perdidos)
+     */
+    void InvalidateCaches() { m_PanelLayer.Invalidate(); }
 };
@@ -10,6 +10,8 @@
  * Responsabilidad ÚNICA:
  * - Procesa WaveEndEvent emitido por WaveSystem
  * - Elimina todos los enemigos acivos cuando termina una ola
+ * - Procesa TimerEvent ENEMY_LIFETIME (programado por EntityManager::CreateEnemy
+ *   si el tipo define "lifetime") y elimina ese enemigo
  * - Proporciona logs de eliminación
  */
 class LifetimeSystem : public ISystem
@@ -19,7 +21,7 @@ public:
     ~LifetimeSystem() override = default;
 
     /**
-     * @brief Procesa WaveEndEvent y elimina todos los enemigos.
+     * @brief Procesa WaveEndEvent / TimerEvent y elimina enemigos.
      * @param world Referencia al mundo que contiene las entidades
      * @param dt Delta time en segundos (no utilizado)
      */
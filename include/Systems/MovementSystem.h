@@ -1,26 +1,47 @@
 #pragma once
 #include "../ISystem.h"
 #include "../World.h"
+#include "../MovementKernel.h"
+#include <vector>
+
+// Declaración forward de GameContext (se define en Game.h)
+struct GameContext;
+class TransformComponent;
 
 /**
  * @class MovementSystem
- * @brief Aplica velocidad a las entidades en cada frame.
+ * @brief Aplica velocidad a las entidades y las confina al mundo en cada tick.
  *
  * Responsabilidades:
  * - Actualizar posiciones basadas en velocidad: pos += vel * dt
+ * - Confinar al rectángulo del mundo y reflejar la velocidad en los bordes
  * - Frame-rate independent: el multiplicador dt asegura movimiento consistente
  *
  * Optimizaciones:
  * - Solo itera Jugador + Enemigos (usando caches O(1) de World)
  * - NO itera obstáculos (son estáticos, vel = 0)
+ * - Punteros a TransformComponent cacheados; se reconstruyen solo cuando
+ *   cambia World::GetEnemyVersion()
+ * - Integración y confinamiento fusionados en MovementKernel::Step (SSE) sobre
+ *   un MovementBatch: los bordes no generan CollisionEvent ni búsquedas por ID
  *
  * Ecuación:
  * - new_position = old_position + velocity * deltaTime
+ * - fuera del mundo: position = borde, velocity = -velocity (por eje)
+ * - Los empujes posteriores (CollisionResponseSystem) vuelven a confinar la posición
+ *
+ * Interpolación:
+ * - Antes de integrar guarda m_PreviousPosition = m_Position; RenderSystem dibuja
+ *   mix(previa, actual, alpha) con el alpha del acumulador de paso fijo
  */
 class MovementSystem : public ISystem
 {
 public:
-    MovementSystem();
+    /**
+     * @brief Inicializa el sistema de movimiento
+     * @param ctx Contexto del juego (dimensiones del mundo para confinar)
+     */
+    MovementSystem(const GameContext &ctx);
 
     /**
      * @brief Actualiza posiciones de todas las entidades dinámicas
@@ -28,4 +49,41 @@ public:
      * @param dt Tiempo transcurrido en segundos
      */
     void update(World &world, float dt) override;
+
+    /**
+     * @brief Recursos para SystemScheduler (Integra jugador y enemigos)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::PLAYER | SystemResource::ENEMIES,
+                SystemResource::PLAYER | SystemResource::ENEMIES};
+    }
+
+private:
+    // ===== CONTEXTO =====
+    float m_WorldWidth;  ///< Ancho del mundo (para confinar)
+    float m_WorldHeight; ///< Alto del mundo (para confinar)
+
+    // ===== CACHÉ DE COMPONENTES =====
+    std::vector<TransformComponent *> m_EnemyTransforms; ///< Transform por enemigo (orden de World::GetEnemies)
+    std::vector<float> m_EnemyWidths;                    ///< Ancho del collider por enemigo
+    std::vector<float> m_EnemyHeights;                   ///< Alto del collider por enemigo
+    uint32_t m_EnemyVersion;                             ///< Versión de enemigos usada para la caché
+    bool m_HasEnemyCache;                                ///< ¿Se construyó la caché al menos una vez?
+
+    // ===== LOTE =====
+    MovementBatch m_Batch;                           ///< Datos SoA del tick (capacidad reutilizada)
+    std::vector<TransformComponent *> m_BatchOwners; ///< TransformComponent de cada entrada del lote
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Reconstruye la caché de enemigos si cambió el conjunto
+     * @param world Referencia al mundo
+     */
+    void refreshEnemies(World &world);
+
+    /**
+     * @brief Agrega una entidad al lote y guarda su posición previa
+     */
+    void enqueue(TransformComponent *transform, float width, float height);
 };
@@ -9,6 +9,8 @@
  *
  * Responsabilidades:
  * - Cargar archivo de música FLAC
+ * - Separar la decodificación (DecodeMusic, en un hilo de arranque) de la
+ *   apertura del dispositivo (OpenStream, tras SDL_Init)
  * - Reproducir música de fondo
  * - Detener música
  * - Limpiar recursos de audio
@@ -23,6 +25,7 @@ class MusicSystem
 private:
     SDL_AudioStream *m_MusicStream;  ///< Stream de reproducción de audio
     SDL_AudioDeviceID m_AudioDevice; ///< ID del dispositivo de audio
+    SDL_AudioSpec m_Spec;            ///< Formato del audio decodificado
     Uint8 *m_AudioBuffer;            ///< Buffer de datos de audio
     Uint32 m_AudioLen;               ///< Tamaño del buffer
     Uint32 m_AudioPos;               ///< Posición actual de lectura
@@ -48,6 +51,22 @@ public:
      */
     bool LoadMusic(const std::string &filePath);
 
+    /**
+     * @brief Solo lee y decodifica el WAV a memoria (cualquier hilo, no necesita SDL_Init)
+     * @param filePath Ruta al archivo de música
+     * @return true si la decodificación fue exitosa
+     */
+    bool DecodeMusic(const std::string &filePath);
+
+    /**
+     * @brief Crea el stream y abre el dispositivo con el audio ya decodificado
+     *
+     * Requiere SDL_INIT_AUDIO y un DecodeMusic() exitoso.
+     *
+     * @return true si el audio quedó listo para Play()
+     */
+    bool OpenStream();
+
     /**
      * @brief Inicia la reproducción de música
      */
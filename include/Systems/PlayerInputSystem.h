@@ -11,7 +11,7 @@ struct GameContext;
  * @brief Procesa input del teclado y actualiza velocidad del jugador.
  *
  * Responsabilidades:
- * - Leer estado del teclado (W/A/S/D)
+ * - Leer el teclado del tick (W/A/S/D) con las transiciones dentro del tick
  * - Calcular vector de velocidad deseado
  * - Asignar velocidad al jugador
  *
@@ -20,6 +20,7 @@ struct GameContext;
  * - S: Abajo (velocity.y = +playerSpeed)
  * - A: Izquierda (velocity.x = -playerSpeed)
  * - D: Derecha (velocity.x = +playerSpeed)
+ * - Cada término se escala por World::GetKeyHeldFraction (toques sub-tick)
  *
  * Frame-rate Independence:
  * - Se calcula velocidad en px/s, la multiplicación por dt ocurre en MovementSystem
@@ -30,16 +31,9 @@ class PlayerInputSystem : public ISystem
 {
 private:
     // ===== PARÁMETROS =====
-    float m_PlayerSpeed;    ///< Velocidad del jugador en píxeles/segundo
-    float m_WorldWidth;     ///< Ancho del mundo (para posibles restricciones)
-    float m_WorldHeight;    ///< Alto del mundo (para posibles restricciones)
-    const bool *m_KeyState; ///< Puntero al estado del teclado SDL
-
-    // ===== MÉTODOS PRIVADOS =====
-    /**
-     * @brief Actualiza m_KeyState con el estado actual del teclado SDL
-     */
-    void updateKeyState();
+    float m_PlayerSpeed; ///< Velocidad del jugador en píxeles/segundo
+    float m_WorldWidth;  ///< Ancho del mundo (para posibles restricciones)
+    float m_WorldHeight; ///< Alto del mundo (para posibles restricciones)
 
 public:
     // ===== CONSTRUCTOR =====
@@ -57,4 +51,13 @@ public:
      * @param dt Tiempo transcurrido en segundos (no usado en este sistema)
      */
     void update(World &world, float dt) override;
+
+    /**
+     * @brief Recursos para SystemScheduler (Teclado -> velocidad del jugador)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::INPUT | SystemResource::PLAYER,
+                SystemResource::PLAYER};
+    }
 };
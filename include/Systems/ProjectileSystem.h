@@ -0,0 +1,121 @@
+#pragma once
+#include "../ISystem.h"
+#include "../World.h"
+#include "../ConfigLoader.h"
+#include "../ProjectilePool.h"
+#include "../SpatialGrid.h"
+#include "../RenderSnapshot.h"
+#include <SDL3/SDL.h>
+#include <glm/glm.hpp>
+#include <vector>
+
+// Declaración forward de GameContext (se define en Game.h)
+struct GameContext;
+class TransformComponent;
+
+/**
+ * @class ProjectileSystem
+ * @brief Disparos del jugador: pool SoA propio, sin entidades ni componentes.
+ *
+ * Responsabilidades:
+ * - Disparar con ESPACIO (cadencia fireRate) en la dirección en la que mira el jugador
+ * - Integrar y expirar todos los proyectiles en una pasada (ProjectilePool::Integrate)
+ * - Detectar impactos contra enemigos con una SpatialGrid de centros de enemigos
+ * - Emitir DamageEvent por impacto (DamageSystem aplica el daño) y liberar el proyectil
+ * - Copiar los proyectiles vivos al RenderSnapshot (RenderSystem los dibuja con
+ *   una sola llamada a SDL_RenderFillRects)
+ *
+ * Rendimiento:
+ * - Disparar y expirar no reservan memoria: el pool tiene capacidad fija
+ *   desde el constructor
+ * - Los proyectiles no pasan por World::createEntity ni por GetComponent
+ * - Transform/collider de los enemigos cacheados por World::GetEnemyVersion()
+ *
+ * Orden:
+ * - Después de MovementSystem (posiciones finales del tick) y antes de DamageSystem
+ */
+class ProjectileSystem : public ISystem
+{
+public:
+    // ===== CONSTRUCTOR =====
+    /**
+     * @brief Inicializa el pool y la rejilla de colisión
+     * @param ctx Contexto del juego (dimensiones del mundo)
+     * @param config Parámetros de los disparos (settings.json)
+     */
+    ProjectileSystem(const GameContext &ctx, const ConfigLoader::ProjectileConfig &config);
+
+    // ===== INTERFAZ ISystem =====
+    /**
+     * @brief Dispara, integra, expira y colisiona los proyectiles
+     * @param world Referencia al mundo
+     * @param dt Tiempo transcurrido en segundos
+     */
+    void update(World &world, float dt) override;
+
+    /**
+     * @brief Recursos para SystemScheduler (Pool propio; impactos como DamageEvent)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::INPUT | SystemResource::PLAYER | SystemResource::ENEMIES | SystemResource::PROJECTILES,
+                SystemResource::PROJECTILES | SystemResource::EVENTS};
+    }
+
+    // ===== CAPTURA =====
+    /**
+     * @brief Copia posición anterior/actual de los proyectiles vivos al snapshot
+     *
+     * Si snapshot.camera está activa (RenderSystem ya capturó), se omiten los
+     * proyectiles fuera de la vista.
+     *
+     * @param snapshot Ranura de escritura del RenderSnapshotBuffer
+     */
+    void Capture(RenderSnapshot &snapshot) const;
+
+    /**
+     * @brief Proyectiles vivos (para HUD/depuración)
+     */
+    size_t GetActiveCount() const { return m_Pool.GetActiveCount(); }
+
+private:
+    // ===== CONTEXTO =====
+    float m_WorldWidth;  ///< Ancho del mundo (expiración por borde)
+    float m_WorldHeight; ///< Alto del mundo (expiración por borde)
+
+    // ===== PARÁMETROS =====
+    ConfigLoader::ProjectileConfig m_Config; ///< Velocidad, vida, daño, cadencia, tamaño
+
+    // ===== ESTADO DE DISPARO =====
+    float m_Cooldown;   ///< Segundos hasta el próximo disparo permitido
+    glm::vec2 m_Facing; ///< Última dirección de movimiento del jugador (unitaria)
+
+    // ===== POOL =====
+    ProjectilePool m_Pool; ///< Proyectiles (SoA, capacidad fija)
+
+    // ===== BROADPHASE =====
+    SpatialGrid m_EnemyGrid;                             ///< Centros de enemigos por celda
+    std::vector<TransformComponent *> m_EnemyTransforms; ///< Transform por enemigo (orden de World::GetEnemies)
+    std::vector<uint32_t> m_EnemyIds;                    ///< ID de cada enemigo cacheado
+    std::vector<glm::vec2> m_EnemyHalfSizes;             ///< Mitad del collider por enemigo
+    std::vector<float> m_EnemyX, m_EnemyY;               ///< Centros del tick actual
+    float m_MaxEnemyReach;                               ///< Mayor semidiagonal de collider de enemigo
+    uint32_t m_EnemyVersion;                             ///< Versión de enemigos usada para la caché
+    bool m_HasEnemyCache;                                ///< ¿Se construyó la caché al menos una vez?
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Dispara según teclado y cadencia desde el centro del jugador
+     */
+    void fire(World &world, float dt);
+
+    /**
+     * @brief Reconstruye la caché de enemigos si cambió el conjunto
+     */
+    void refreshEnemies(World &world);
+
+    /**
+     * @brief Prueba cada proyectil contra los enemigos cercanos y emite DamageEvent
+     */
+    void resolveHits(World &world);
+};
@@ -1,55 +1,146 @@
 #pragma once
 #include "../ISystem.h"
 #include "../World.h"
+#include "../RenderSnapshot.h"
+#include "../DrawQueue.h"
+#include "../CachedLayer.h"
 #include <SDL3/SDL.h>
+#include <vector>
+
+class SpriteBatch;
 
 // Declaración forward de GameContext (se define en Game.h)
 struct GameContext;
 
 /**
  * @class RenderSystem
- * @brief Renderiza sprites de todas las entidades.
+ * @brief Captura y dibuja los sprites de todas las entidades.
  *
  * Responsabilidades:
- * - Itera entidades con SpriteComponent
- * - Obtiene posición/tamaño de TransformComponent y ColliderComponent
- * - Renderiza texturas en pantalla
+ * - Captura (hilo de simulación, update): copia jugador, enemigos y obstáculos al
+ *   RenderSnapshot asignado con SetSnapshot()
+ * - Dibujo (hilo principal, Draw): fondo, sprites y proyectiles a partir del snapshot
  * - Mantiene timer de tiempo transcurrido (para HUD)
  *
- * Renderizado:
- * - Obtiene SDL_Texture de SpriteComponent
- * - Crea SDL_FRect con posición y dimensiones
- * - Renderiza con SDL_RenderTexture
+ * Separación simulación / render:
+ * - Draw() nunca toca World, entidades ni componentes: el frame N se dibuja
+ *   mientras la simulación calcula el N+1
+ * - Cada SpriteDraw guarda textura, rectángulo anterior/actual, capa y parpadeo
+ * - Las texturas se resuelven al dibujar (placeholder mientras una textura no se
+ *   ha subido): el fondo con AssetLoader::Resolve(), los sprites con ResolveRegion()
+ *   (página de atlas + rectángulo origen); los sprites de un frame se resuelven
+ *   juntos con ResolveRegions, un solo lock del loader por lista
+ * - Draw() emite un comando por quad en una DrawQueue con clave de 64 bits
+ *   (capa | profundidad | textura), la ordena y la envía al SpriteBatch
+ * - Capa de cada sprite: SpriteComponent::m_Layer. En WORLD jugador y enemigos
+ *   se ordenan por su borde inferior; los quads de la misma textura quedan seguidos
+ *
+ * Capa estática cacheada:
+ * - Los obstáculos en capas BACKGROUND/GROUND van a RenderSnapshot::staticSprites
+ * - Fondo + obstáculos se dibujan una vez en un CachedLayer y cada frame se
+ *   encola un único quad
+ * - Clave: (handle del fondo, World::GetObstacleVersion()): se regenera al
+ *   cambiar la oleada/fase o el conjunto de obstáculos, nunca por frame
+ *
+ * Cámara y culling:
+ * - Si el jugador tiene CameraComponent, la captura la centra en él (limitada
+ *   al mundo) y copia la vista al snapshot
+ * - Enemigos y sprites WORLD cuyo rectángulo anterior y actual quedan fuera de
+ *   la vista (más CULL_MARGIN) no llegan al snapshot: el coste de captura y de
+ *   dibujo depende de lo visible, no del total de entidades
+ * - Draw() resta la posición interpolada de la cámara (en píxeles enteros); de
+ *   la capa estática (tamaño mundo) solo se dibuja el rectángulo visible
+ *
+ * Interpolación (paso fijo):
+ * - Jugador, enemigos y proyectiles se dibujan en mix(anterior, actual, alpha)
+ * - alpha = RenderSnapshot::InterpolationAt(ahora) (1 = estado actual)
  *
  * Timer:
- * - Acumula deltaTime para tracking de gameplay
- * - Usado por Game para obtener tiempo de Game Over
+ * - Acumula el dt simulado en cada captura
+ * - Se copia al snapshot (pantalla de Game Over)
  */
 class RenderSystem : public ISystem
 {
 private:
     // ===== CONTEXTO SDL =====
     SDL_Renderer *m_Renderer; ///< Contexto de renderizado SDL3
+    AssetLoader *m_Assets;    ///< Resuelve los TextureHandle al dibujar
+    SpriteBatch *m_Batch;     ///< Acumula los quads del frame (un SDL_RenderGeometry por lote)
+    float m_WorldWidth;       ///< Ancho del fondo (píxeles)
+    float m_WorldHeight;      ///< Alto del fondo (píxeles)
+    float m_ViewWidth;        ///< Ancho de la vista (ventana) sin cámara
+    float m_ViewHeight;       ///< Alto de la vista (ventana) sin cámara
 
     // ===== TRACKING DE TIEMPO =====
     float m_ElapsedTime; ///< Tiempo acumulado en segundos
 
+    // ===== CAPTURA =====
+    RenderSnapshot *m_Snapshot; ///< Destino de la próxima captura (no propietario)
+
+    // ===== DIBUJO =====
+    DrawQueue m_Queue;                    ///< Comandos del frame (reutilizada: sin reservas tras los primeros frames)
+    CachedLayer m_StaticLayer;            ///< Fondo + obstáculos estáticos (se regenera al cambiar de oleada/fase)
+    bool m_CacheLayers;                   ///< false = fondo y obstáculos se dibujan cada frame
+    std::vector<TextureHandle> m_Handles; ///< Handles de los sprites a resolver (reutilizado)
+    std::vector<TextureRegion> m_Regions; ///< Región de cada handle (un solo lock de AssetLoader)
+
+    /**
+     * @brief Encola el fondo y los obstáculos estáticos (1 quad si la capa cacheada es válida)
+     * @param view Rectángulo visible del mundo (posición de la cámara + tamaño de la ventana)
+     */
+    void DrawStaticLayer(const RenderSnapshot &snapshot, const SDL_FRect &view);
+
+    /**
+     * @brief Resuelve la textura de cada sprite en m_Regions (AssetLoader::ResolveRegions)
+     */
+    void ResolveSprites(const std::vector<SpriteDraw> &sprites);
+
+    /**
+     * @brief ¿Fondo y obstáculos ya tienen su textura definitiva? (no cachear placeholders)
+     */
+    bool StaticTexturesReady(const RenderSnapshot &snapshot) const;
+
 public:
     // ===== CONSTRUCTOR =====
     /**
      * @brief Inicializa el sistema de renderizado
-     * @param ctx Contexto del juego (contiene renderer)
+     * @param ctx Contexto del juego (renderer, assets y dimensiones del fondo)
      */
     RenderSystem(const GameContext &ctx);
 
     // ===== INTERFAZ ISystem =====
     /**
-     * @brief Renderiza sprites de todas las entidades
+     * @brief Captura los sprites de todas las entidades en el snapshot asignado
      * @param world Referencia al mundo
-     * @param dt Tiempo transcurrido en segundos (acumulado en m_ElapsedTime)
+     * @param dt Tiempo simulado desde la captura anterior (acumulado en m_ElapsedTime)
      */
     void update(World &world, float dt) override;
 
+    // ===== CAPTURA =====
+    /**
+     * @brief Asigna el snapshot que rellenará el próximo update()
+     * @param snapshot Ranura de escritura del RenderSnapshotBuffer
+     */
+    void SetSnapshot(RenderSnapshot *snapshot) { m_Snapshot = snapshot; }
+
+    // ===== DIBUJO =====
+    /**
+     * @brief Dibuja fondo, sprites y proyectiles de un snapshot
+     * @param snapshot Snapshot adquirido por el render
+     * @param alpha Fracción [0, 1] entre el tick anterior y el actual
+     */
+    void Draw(const RenderSnapshot &snapshot, float alpha);
+
+    /**
+     * @brief Activa o desactiva la capa cacheada de fondo + obstáculos
+     */
+    void SetLayerCaching(bool enabled) { m_CacheLayers = enabled; }
+
+    /**
+     * @brief Fuerza a regenerar la capa cacheada (render targets perdidos)
+     */
+    void InvalidateCaches() { m_StaticLayer.Invalidate(); }
+
     // ===== TIMER =====
     /**
      * @brief Reinicia el contador de tiempo a 0
@@ -2,6 +2,7 @@
 #include "../ISystem.h"
 #include "../World.h"
 #include "../ConfigLoader.h"
+#include "../AssetLoader.h"
 #include <SDL3/SDL.h>
 #include <vector>
 
@@ -34,10 +35,10 @@
 class SpawnSystem : public ISystem
 {
 private:
-    // ===== CONTEXTO SDL & MUNDO =====
-    SDL_Renderer *m_Renderer; ///< Renderer para crear sprites
-    float m_WorldWidth;       ///< Ancho del mundo (para spawn aleatorio)
-    float m_WorldHeight;      ///< Alto del mundo (para spawn aleatorio)
+    // ===== CONTEXTO & MUNDO =====
+    AssetLoader *m_Assets; ///< Cargador de texturas para crear sprites
+    float m_WorldWidth;    ///< Ancho del mundo (para spawn aleatorio)
+    float m_WorldHeight;   ///< Alto del mundo (para spawn aleatorio)
 
     // ===== CONFIGURACIÓN =====
     std::vector<ConfigLoader::EnemyTypeConfig> m_EnemyTypes; ///< Tipos de enemigos disponibles
@@ -47,12 +48,12 @@ public:
     // ===== CONSTRUCTOR =====
     /**
      * @brief Inicializa el sistema de spawn
-     * @param renderer Contexto SDL3 renderer
+     * @param assets Cargador de texturas (no propietario)
      * @param worldWidth Ancho del mundo
      * @param worldHeight Alto del mundo
      * @param enemyTypes Vector de tipos de enemigos desde JSON
      */
-    SpawnSystem(SDL_Renderer *renderer, float worldWidth, float worldHeight,
+    SpawnSystem(AssetLoader *assets, float worldWidth, float worldHeight,
                 const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes);
 
     // ===== INTERFAZ ISystem =====
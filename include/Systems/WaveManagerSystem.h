@@ -26,10 +26,10 @@ struct GameContext;
  * 1. WaveSystem gestiona timeline y emite eventos (SpawnEnemy, WaveStart, WaveEnd)
  * 2. SpawnSystem escucha SpawnEnemyEvent y crea enemigos
  * 3. LifetimeSystem escucha WaveEndEvent y limpia enemigos/obstáculos
- * 4. WaveSystem renderiza fondos según fase
+ * 4. WaveSystem pide el fondo de cada fase (lo dibuja RenderSystem desde el snapshot)
  *
  * Subsistemas internos:
- * - m_WaveSystem: Orquestación temporal + renderizado de fondos
+ * - m_WaveSystem: Orquestación temporal + textura de fondo
  * - m_SpawnSystem: Creación de entidades dinámicas
  * - m_LifetimeSystem: Limpieza al fin de ola
  *
@@ -39,7 +39,7 @@ class WaveManagerSystem : public ISystem
 {
 private:
     // ===== SUBSISTEMAS INTERNOS =====
-    std::unique_ptr<WaveSystem> m_WaveSystem;         ///< Gestor de oleadas + renderizado de fondos
+    std::unique_ptr<WaveSystem> m_WaveSystem;         ///< Gestor de oleadas + textura de fondo
     std::unique_ptr<SpawnSystem> m_SpawnSystem;       ///< Creador de enemigos y obstáculos
     std::unique_ptr<LifetimeSystem> m_LifetimeSystem; ///< Limpieza de entidades
 
@@ -72,10 +72,20 @@ public:
     void update(World &world, float dt) override;
 
     /**
-     * @brief Fase de RENDER: Renderiza fondos y procesa limpieza
-     * @param world Referencia al mundo
+     * @brief Recursos para SystemScheduler (Crea/elimina entidades; las texturas las pide a AssetLoader)
+     */
+    SystemAccess access() const override
+    {
+        return {SystemResource::ALL,
+                SystemResource::ENTITIES | SystemResource::EVENTS |
+                SystemResource::ENEMIES | SystemResource::OBSTACLES};
+    }
+
+    /**
+     * @brief Fondo actual para el RenderSnapshot (el render no llama a este sistema)
+     * @return Handle del fondo (inválido si no hay)
      */
-    void render(World &world);
+    TextureHandle GetBackgroundTexture() const;
 
     // ===== CONFIGURACIÓN =====
     /**
@@ -97,6 +107,12 @@ public:
      */
     void LoadObstaclesByPhase(const ConfigLoader::ObstaclesByPhaseData &obstacles);
 
+    /**
+     * @brief Antelación con la que se precarga el fondo de la siguiente oleada
+     * @param seconds Segundos antes del final de la oleada actual
+     */
+    void SetPrefetchLeadTime(float seconds);
+
     // ===== CONTROL DE JUEGO =====
     /**
      * @brief Inicia las oleadas
@@ -2,20 +2,20 @@
 #include "../ISystem.h"
 #include "../World.h"
 #include "../ConfigLoader.h"
+#include "../AssetLoader.h"
 #include <SDL3/SDL.h>
-#include <SDL3_image/SDL_image.h>
 #include <vector>
 #include <string>
 
 /**
  * @class WaveSystem
- * @brief Gestor de oleadas y renderizado de fondos.
+ * @brief Gestor de oleadas y fondos.
  *
  * Responsabilidades:
  * - Mantener timeline de oleadas (duración, spawn rate)
  * - Emitir SpawnEnemyEvent en intervalo especificado
  * - Emitir WaveStartEvent y WaveEndEvent en transiciones
- * - Cargar y renderizar texturas de fondos por fase
+ * - Pedir texturas de fondos por fase
  * - Gestionar transición a siguiente oleada
  *
  * Timeline de Oleada:
@@ -24,10 +24,21 @@
  * 3. Al alcanzar duration: emite WaveEndEvent y prepara transición
  * 4. Siguiente frame: avanza a siguiente oleada
  *
- * Renderizado:
- * - Carga textura de fondo según phaseId
- * - Renderiza fondo en cada frame
- * - Libera textura anterior al cambiar oleada
+ * Campo de distancia de obstáculos:
+ * - StartWave conoce todas las posiciones de la fase, así que construye ahí
+ *   World::GetObstacleField() (una vez por fase, sin esperar a las entidades)
+ * - EndWave lo vacía junto con la limpieza de obstáculos
+ *
+ * Fondo:
+ * - Pide la textura de fondo a AssetLoader al iniciar cada oleada (StartWave)
+ * - GetBackgroundTexture() la expone para el RenderSnapshot (no dibuja)
+ * - Guarda una TextureRef: al cambiar de oleada suelta la del fondo anterior
+ *
+ * Precarga:
+ * - Cuando a la oleada actual le quedan prefetchLeadTime segundos, se adquiere el
+ *   fondo de la siguiente: se decodifica mientras se juega y la transición no carga nada
+ * - La referencia de la precarga se suelta en StartWave, cuando ya hay la propia
+ * - Enemigos y obstáculos no se precargan: sus sprites están en el atlas
  *
  * Nota: WaveData contiene toda la configuración de una oleada
  *       (número, fase, fondo, enemigos, timing)
@@ -55,9 +66,11 @@ private:
     std::vector<WaveData> m_Waves;                           ///< Todas las oleadas definidas
     std::vector<ConfigLoader::EnemyTypeConfig> m_EnemyTypes; ///< Tipos de enemigos disponibles
     ConfigLoader::ObstaclesByPhaseData m_ObstaclesByPhase;   ///< Obstáculos por fase
+    ConfigLoader::ObstacleConfig m_ObstacleConfig;           ///< Tamaño de obstáculo (para el SDF)
 
     // ===== RENDERIZADO =====
-    SDL_Texture *m_CurrentBackgroundTexture; ///< Textura del fondo actual (propiedad)
+    TextureRef m_CurrentBackground;    ///< Fondo de la oleada actual (referencia en AssetLoader)
+    TextureRef m_PrefetchedBackground; ///< Fondo de la siguiente oleada, hasta que StartWave lo adquiera
 
     // ===== ESTADO DE OLEADA =====
     int m_CurrentWave;          ///< Índice de oleada actual
@@ -67,28 +80,27 @@ private:
     bool m_WaveInProgress;      ///< ¿Hay oleada activa?
     bool m_WaveEnded;           ///< Flag: oleada terminó, esperar siguiente frame para avanzar
 
+    // ===== PRECARGA =====
+    float m_PrefetchLeadTime; ///< Segundos antes del final de oleada para pedir la siguiente
+    int m_PrefetchedWave;     ///< Última oleada cuyo fondo ya se pidió (-1 = ninguna)
+
     // ===== CONTEXTO SDL =====
-    SDL_Renderer *m_Renderer; ///< Contexto de renderizado SDL3
-    float m_ScreenWidth;      ///< Ancho de pantalla
-    float m_ScreenHeight;     ///< Alto de pantalla
+    AssetLoader *m_Assets; ///< Cargador de texturas de fondo
+    float m_WorldWidth;    ///< Ancho del mundo (extensión del SDF)
+    float m_WorldHeight;   ///< Alto del mundo (extensión del SDF)
 
 public:
-    // ===== CONSTRUCTOR & DESTRUCTOR =====
+    // ===== CONSTRUCTOR =====
     /**
      * @brief Inicializa el sistema de oleadas
-     * @param renderer Contexto SDL3 renderer
-     * @param screenWidth Ancho de pantalla
-     * @param screenHeight Alto de pantalla
+     * @param assets Cargador de texturas (no propietario)
+     * @param worldWidth Ancho del mundo
+     * @param worldHeight Alto del mundo
      * @param enemyTypes Vector de tipos de enemigos disponibles
      */
-    WaveSystem(SDL_Renderer *renderer, float screenWidth, float screenHeight,
+    WaveSystem(AssetLoader *assets, float worldWidth, float worldHeight,
                const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes);
 
-    /**
-     * @brief Libera texturas de fondos
-     */
-    ~WaveSystem();
-
     // ===== INTERFAZ ISystem =====
     /**
      * @brief Actualiza timeline de oleada y emite eventos
@@ -111,12 +123,23 @@ public:
      */
     void LoadObstaclesByPhase(const ConfigLoader::ObstaclesByPhaseData &obstacles);
 
-    // ===== RENDERIZADO =====
     /**
-     * @brief Renderiza el fondo actual
-     * Llamar desde WaveManagerSystem::render()
+     * @brief Asigna configuración de obstáculos (tamaño del collider para el SDF)
+     * @param config Configuración del obstáculo
+     */
+    void SetObstacleConfig(const ConfigLoader::ObstacleConfig &config) { m_ObstacleConfig = config; }
+
+    /**
+     * @brief Antelación de la precarga de la siguiente oleada
+     * @param seconds Segundos antes del final de la oleada actual (>= duración = al empezarla)
+     */
+    void SetPrefetchLeadTime(float seconds) { m_PrefetchLeadTime = seconds; }
+
+    // ===== FONDO =====
+    /**
+     * @brief Fondo de la oleada actual (handle inválido si no hay)
      */
-    void renderBackground();
+    TextureHandle GetBackgroundTexture() const { return m_CurrentBackground.Get(); }
 
     // ===== CONTROL DE OLEADAS =====
     /**
@@ -137,6 +160,12 @@ public:
      */
     void NextWave(World &world);
 
+    /**
+     * @brief Adquiere el fondo de una oleada antes de empezarla (no bloquea)
+     * @param waveIndex Índice de la oleada (0-indexed)
+     */
+    void PrefetchWave(int waveIndex);
+
     // ===== CONSULTAS =====
     /**
      * @brief Obtiene número de oleada actual
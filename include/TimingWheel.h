@@ -0,0 +1,142 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @struct TimerHandle
+ * @brief Identifica un temporizador programado (para cancelarlo).
+ *
+ * generation evita cancelar por error un temporizador nuevo que
+ * reutiliza la misma entrada del pool.
+ */
+struct TimerHandle
+{
+    uint32_t index = 0xFFFFFFFFu;
+    uint32_t generation = 0;
+};
+
+/**
+ * @class TimingWheel
+ * @brief Rueda de temporización jerárquica (4 niveles x 64 ranuras) en ticks enteros.
+ *
+ * Responsabilidades:
+ * - Programar "disparar en el tick T para la entidad E con la etiqueta K"
+ * - Avanzar el tiempo y devolver los temporizadores vencidos
+ * - Cancelar temporizadores pendientes
+ *
+ * Estructura:
+ * - Nivel 0 cubre los próximos 64 ticks (una ranura por tick)
+ * - Nivel L cubre 64^(L+1) ticks; cada ranura agrupa 64^L ticks
+ * - Al completar una vuelta del nivel L-1, la ranura actual del nivel L se
+ *   redistribuye (cascada) hacia niveles inferiores
+ * - Rango máximo: 64^4 ticks (~3 días a 60 Hz); plazos mayores se limitan
+ *
+ * Coste:
+ * - Schedule / Cancel: O(1)
+ * - Advance: O(1) amortizado por tick (cada temporizador baja como mucho 3 niveles)
+ * - Entradas en un pool con free list y listas enlazadas por índice:
+ *   sin allocations una vez alcanzada la capacidad máxima
+ *
+ * Usado por:
+ * - World: Servicio de temporizadores por entidad (ScheduleTimer / AdvanceTimers)
+ */
+class TimingWheel
+{
+public:
+    /**
+     * @struct Expiration
+     * @brief Temporizador vencido devuelto por Advance()
+     */
+    struct Expiration
+    {
+        uint32_t entityId;
+        uint32_t tag;
+    };
+
+    // ===== CONSTRUCTOR =====
+    TimingWheel();
+
+    // ===== PROGRAMACIÓN =====
+    /**
+     * @brief Programa un temporizador
+     * @param delayTicks Ticks hasta el disparo (mínimo 1)
+     * @param entityId Entidad asociada
+     * @param tag Etiqueta definida por el usuario (ej: TimerTag)
+     * @return Handle para Cancel()
+     */
+    TimerHandle Schedule(uint64_t delayTicks, uint32_t entityId, uint32_t tag);
+
+    /**
+     * @brief Cancela un temporizador pendiente (no hace nada si ya disparó)
+     * @param handle Handle devuelto por Schedule()
+     */
+    void Cancel(TimerHandle handle);
+
+    /**
+     * @brief Descarta todos los temporizadores y vuelve al tick 0
+     *
+     * Conserva la capacidad del pool; los handles anteriores quedan invalidados.
+     */
+    void Clear();
+
+    // ===== AVANCE =====
+    /**
+     * @brief Avanza el reloj y agrega los vencidos a out (en orden de tick)
+     * @param ticks Ticks a avanzar
+     * @param out Vector de salida (no se limpia)
+     */
+    void Advance(uint64_t ticks, std::vector<Expiration> &out);
+
+    // ===== CONSULTAS =====
+    /**
+     * @brief Tick actual
+     */
+    uint64_t GetNow() const { return m_Now; }
+
+    /**
+     * @brief Temporizadores pendientes (sin contar cancelados)
+     */
+    size_t GetPendingCount() const { return m_Pending; }
+
+private:
+    // ===== CONSTANTES =====
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr uint32_t SLOTS = 1u << SLOT_BITS;
+    static constexpr uint32_t SLOT_MASK = SLOTS - 1;
+    static constexpr uint32_t NIL = 0xFFFFFFFFu;
+
+    // ===== ENTRADAS =====
+    struct Entry
+    {
+        uint64_t deadline;   ///< Tick absoluto de disparo
+        uint32_t entityId;   ///< Entidad asociada
+        uint32_t tag;        ///< Etiqueta del usuario
+        uint32_t next;       ///< Siguiente en la ranura o en la free list
+        uint32_t generation; ///< Se incrementa al liberar la entrada
+        bool cancelled;      ///< Cancelado: se libera al llegar a su ranura
+    };
+
+    std::vector<Entry> m_Entries;       ///< Pool de entradas
+    uint32_t m_FreeHead;                ///< Primera entrada libre (NIL si ninguna)
+    uint32_t m_Slots[LEVELS][SLOTS];    ///< Cabeza de la lista de cada ranura
+    uint64_t m_Now;                     ///< Tick actual
+    size_t m_Pending;                   ///< Temporizadores activos
+
+    // ===== MÉTODOS PRIVADOS =====
+    /**
+     * @brief Inserta una entrada en la ranura que corresponde a su deadline
+     */
+    void Insert(uint32_t index);
+
+    /**
+     * @brief Redistribuye la ranura actual de un nivel hacia niveles inferiores
+     */
+    void Cascade(int level);
+
+    /**
+     * @brief Devuelve una entrada a la free list
+     */
+    void Release(uint32_t index);
+};
@@ -4,9 +4,14 @@
 #include <cstdint>
 #include "Entity.h"
 #include "Event.h"
+#include "DistanceField.h"
+#include "TimingWheel.h"
+#include "InputQueue.h"
+#include <SDL3/SDL_scancode.h>
 #include <vector>
 #include <memory>
 #include <queue>
+#include <random>
 #include <unordered_map>
 
 /**
@@ -18,6 +23,12 @@
  * - Mantener caches de Jugador, Enemigos, Obstáculos
  * - Cola de eventos para comunicación entre sistemas
  * - Búsqueda O(1) de entidades por ID (HashMap)
+ * - Campo de distancia de los obstáculos de la fase actual
+ * - Temporizadores por entidad (rueda jerárquica, O(1) amortizado por tick)
+ * - Teclado del tick: estado al inicio y al final más las transiciones con
+ *   timestamp (la simulación no consulta SDL directamente)
+ * - Generador aleatorio propio: varios World en paralelo no comparten estado y
+ *   una semilla fija reproduce la partida
  *
  * Optimizaciones:
  * - HashMap m_EntityMap para O(1) lookup por ID
@@ -37,9 +48,34 @@ private:
     std::vector<Entity *> m_ObstacleEntities; ///< Caché de obstáculos (referencias)
     bool m_CacheDirty = true;                 ///< Flag: ¿Caches necesitan reconstrucción?
 
+    // ===== VERSIONES DE CACHES =====
+    std::vector<uint32_t> m_EnemyIds;    ///< IDs del último caché de enemigos (detección de cambios)
+    std::vector<uint32_t> m_ObstacleIds; ///< IDs del último caché de obstáculos (detección de cambios)
+    uint32_t m_EnemyVersion = 0;         ///< Se incrementa cada vez que cambia el conjunto de enemigos
+    uint32_t m_ObstacleVersion = 0;      ///< Se incrementa cada vez que cambia el conjunto de obstáculos
+
+    // ===== OBSTÁCULOS ESTÁTICOS =====
+    DistanceField m_ObstacleField; ///< SDF de la fase actual (lo construye WaveSystem::StartWave)
+
+    // ===== TEMPORIZADORES =====
+    TimingWheel m_Timers;                                 ///< Rueda de temporización (ticks enteros)
+    float m_TimerTickSeconds = 1.0f / 60.0f;              ///< Duración de un tick de la rueda
+    float m_TimerAccumulator = 0.0f;                      ///< Tiempo pendiente de convertir en ticks
+    std::vector<TimingWheel::Expiration> m_ExpiredTimers; ///< Buffer reutilizado de vencidos
+
+    // ===== INPUT =====
+    bool m_KeyboardState[SDL_SCANCODE_COUNT] = {};     ///< Teclado al final del tick
+    bool m_KeyboardTickStart[SDL_SCANCODE_COUNT] = {}; ///< Teclado al inicio del tick
+    std::vector<InputEvent> m_TickInput;               ///< Transiciones del tick (en orden)
+    Uint64 m_TickStartNs = 0;                          ///< Inicio del tick (reloj de SDL_GetTicksNS)
+    Uint64 m_TickEndNs = 0;                            ///< Fin del tick
+
     // ===== COLA DE EVENTOS =====
     std::queue<std::unique_ptr<Event>> m_EventQueue; ///< Cola de eventos central
 
+    // ===== ALEATORIEDAD =====
+    std::mt19937 m_Rng{std::random_device{}()}; ///< Generador de la partida (SeedRng para fijarlo)
+
     // ===== MÉTODOS PRIVADOS =====
     /**
      * @brief Reconstruye caches si m_CacheDirty es true
@@ -47,6 +83,15 @@ private:
      */
     void RebuildCacheIfNeeded();
 
+    /**
+     * @brief Compara un caché con la lista de IDs anterior y la actualiza
+     * @return true si el conjunto de entidades cambió
+     *
+     * Se comparan IDs (nunca se reutilizan), no punteros: una entidad nueva
+     * puede ocupar la dirección de memoria de una eliminada.
+     */
+    static bool SyncIds(const std::vector<Entity *> &cache, std::vector<uint32_t> &ids);
+
 public:
     // ===== CONSTRUCTORES & DESTRUCTORES =====
     World();
@@ -65,6 +110,14 @@ public:
      */
     void deleteEntity(uint32_t id);
 
+    /**
+     * @brief Elimina todas las entidades, eventos pendientes y temporizadores
+     *
+     * Para cierres ordenados: los componentes sueltan sus recursos (ej: TextureRef)
+     * mientras sus dueños (AssetLoader) siguen vivos.
+     */
+    void Clear();
+
     // ===== ACCESO RÁPIDO A ENTIDADES =====
     /**
      * @brief Obtiene el jugador (primera entidad)
@@ -84,6 +137,39 @@ public:
      */
     const std::vector<Entity *> &GetObstacles();
 
+    /**
+     * @brief Reconstruye ya las caches pendientes (GetEnemies/GetObstacles/versiones)
+     *
+     * SystemScheduler la llama antes de repartir sistemas entre hilos: así las
+     * lecturas concurrentes nunca disparan la reconstrucción perezosa.
+     */
+    void RefreshCaches() { RebuildCacheIfNeeded(); }
+
+    /**
+     * @brief Versión del conjunto de enemigos
+     * @return Contador que cambia solo cuando se agregan/eliminan enemigos
+     *
+     * Permite a los sistemas cachear punteros a componentes de enemigos
+     * y reconstruirlos únicamente cuando el conjunto cambia.
+     */
+    uint32_t GetEnemyVersion();
+
+    /**
+     * @brief Versión del layout de obstáculos
+     * @return Contador que cambia solo cuando se agregan/eliminan obstáculos
+     *
+     * Permite a los sistemas cachear datos derivados (ej: FlowField)
+     * y reconstruirlos únicamente cuando el layout cambia.
+     */
+    uint32_t GetObstacleVersion();
+
+    /**
+     * @brief Campo de distancia de los obstáculos de la fase actual
+     * @return Referencia al SDF (vacío si la fase no tiene obstáculos)
+     */
+    DistanceField &GetObstacleField() { return m_ObstacleField; }
+    const DistanceField &GetObstacleField() const { return m_ObstacleField; }
+
     /**
      * @brief Obtiene todas las entidades
      * @return Vector const de todas las entidades
@@ -97,6 +183,90 @@ public:
      */
     Entity *FindEntityById(uint32_t id) const;
 
+    // ===== TEMPORIZADORES =====
+    /**
+     * @brief Fija la resolución de la rueda (llamar antes de programar temporizadores)
+     * @param tickSeconds Duración de un tick (ej: el paso fijo de simulación)
+     */
+    void SetTimerResolution(float tickSeconds);
+
+    /**
+     * @brief Programa un TimerEvent para una entidad
+     * @param delaySeconds Segundos hasta el disparo (redondeado hacia arriba a ticks)
+     * @param entityId Entidad asociada
+     * @param tag Efecto programado
+     * @return Handle para CancelTimer()
+     */
+    TimerHandle ScheduleTimer(float delaySeconds, uint32_t entityId, TimerTag tag);
+
+    /**
+     * @brief Cancela un temporizador pendiente
+     * @param handle Handle devuelto por ScheduleTimer()
+     */
+    void CancelTimer(TimerHandle handle);
+
+    /**
+     * @brief Avanza la rueda y emite un TimerEvent por cada temporizador vencido
+     * @param dt Tiempo transcurrido en segundos
+     */
+    void AdvanceTimers(float dt);
+
+    // ===== INPUT =====
+    /**
+     * @brief Fija el teclado para todo el tick, sin transiciones (bots, pruebas)
+     * @param keys Array indexado por SDL_Scancode
+     * @param count Número de entradas de keys
+     */
+    void SetKeyboardState(const bool *keys, size_t count);
+
+    /**
+     * @brief Aplica las transiciones de teclado de un tick
+     *
+     * Timestamps fuera de [startNs, endNs] se ajustan al intervalo: un evento que
+     * llegó tarde cuenta desde el inicio de este tick.
+     *
+     * @param startNs Inicio del tick (reloj de SDL_GetTicksNS)
+     * @param endNs Fin del tick
+     * @param events Transiciones del tick en orden (InputQueue::PopUntil)
+     */
+    void BeginInputTick(Uint64 startNs, Uint64 endNs, const std::vector<InputEvent> &events);
+
+    /**
+     * @brief Estado del teclado al final del tick
+     * @return Array de SDL_SCANCODE_COUNT entradas indexado por SDL_Scancode
+     */
+    const bool *GetKeyboardState() const { return m_KeyboardState; }
+
+    /**
+     * @brief Transiciones del tick actual (timestamps ya ajustados al tick)
+     */
+    const std::vector<InputEvent> &GetTickInput() const { return m_TickInput; }
+
+    /**
+     * @brief Fracción del tick (0..1) durante la que la tecla estuvo pulsada
+     * @param scancode Tecla
+     */
+    float GetKeyHeldFraction(SDL_Scancode scancode) const;
+
+    /**
+     * @brief ¿Estuvo la tecla pulsada en algún momento del tick? (incluye toques cortos)
+     * @param scancode Tecla
+     */
+    bool WasKeyDown(SDL_Scancode scancode) const;
+
+    // ===== ALEATORIEDAD =====
+    /**
+     * @brief Fija la semilla del generador (partidas reproducibles)
+     * @param seed Semilla
+     */
+    void SeedRng(uint32_t seed) { m_Rng.seed(seed); }
+
+    /**
+     * @brief Generador aleatorio de este mundo (usarlo solo desde sistemas que escriben ENTITIES)
+     * @return Referencia a std::mt19937
+     */
+    std::mt19937 &GetRng() { return m_Rng; }
+
     // ===== GESTIÓN DE EVENTOS =====
     /**
      * @brief Emite un evento a la cola
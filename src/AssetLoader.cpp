@@ -0,0 +1,580 @@
+#include "AssetLoader.h"
+#include "AtlasPacker.h"
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+
+AssetLoader::AssetLoader(SDL_Renderer *renderer, size_t decodeThreads, int maxUploadsPerFrame)
+    : m_Renderer(renderer), m_Headless(renderer == nullptr), m_Placeholder(nullptr),
+      m_MaxUploadsPerFrame(maxUploadsPerFrame), m_PendingCount(0), m_UnusedGrace(-1.0f),
+      m_AtlasPageSize(0), m_AtlasBuilt(false), m_AtlasDecoding(0), m_Stop(false)
+{
+    CreatePlaceholder();
+
+    // Headless: nada que subir, así que tampoco nada que decodificar
+    if (m_Headless)
+        return;
+
+    StartThreads(decodeThreads);
+}
+
+AssetLoader::AssetLoader(size_t decodeThreads, int maxUploadsPerFrame)
+    : m_Renderer(nullptr), m_Headless(false), m_Placeholder(nullptr),
+      m_MaxUploadsPerFrame(maxUploadsPerFrame), m_PendingCount(0), m_UnusedGrace(-1.0f),
+      m_AtlasPageSize(0), m_AtlasBuilt(false), m_AtlasDecoding(0), m_Stop(false)
+{
+    StartThreads(decodeThreads);
+}
+
+void AssetLoader::StartThreads(size_t decodeThreads)
+{
+    decodeThreads = std::max<size_t>(1, decodeThreads);
+    for (size_t i = 0; i < decodeThreads; ++i)
+        m_Threads.emplace_back(&AssetLoader::DecodeLoop, this);
+}
+
+void AssetLoader::AttachRenderer(SDL_Renderer *renderer)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Renderer = renderer;
+    }
+    CreatePlaceholder();
+}
+
+AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Stop = true;
+    }
+    m_DecodeWork.notify_all();
+
+    for (std::thread &thread : m_Threads)
+        thread.join();
+
+    for (Entry &entry : m_Entries)
+    {
+        if (entry.surface)
+            SDL_DestroySurface(entry.surface);
+        if (entry.texture && !entry.inAtlas)
+            SDL_DestroyTexture(entry.texture);
+    }
+
+    for (SDL_Texture *page : m_AtlasPages)
+        SDL_DestroyTexture(page);
+
+    if (m_Placeholder)
+        SDL_DestroyTexture(m_Placeholder);
+}
+
+void AssetLoader::CreatePlaceholder()
+{
+    if (!m_Renderer)
+        return;
+
+    m_Placeholder = SDL_CreateTexture(m_Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, 1, 1);
+    if (!m_Placeholder)
+    {
+        spdlog::warn("AssetLoader: No se pudo crear el placeholder: {}", SDL_GetError());
+        return;
+    }
+
+    const Uint8 pixel[4] = {255, 255, 255, 96};
+    SDL_UpdateTexture(m_Placeholder, nullptr, pixel, sizeof(pixel));
+    SDL_SetTextureBlendMode(m_Placeholder, SDL_BLENDMODE_BLEND);
+}
+
+TextureHandle AssetLoader::RequestTexture(const std::string &filePath)
+{
+    return Request(filePath, false);
+}
+
+TextureHandle AssetLoader::RequestAtlasSprite(const std::string &filePath)
+{
+    return Request(filePath, true);
+}
+
+TextureHandle AssetLoader::Request(const std::string &filePath, bool atlas)
+{
+    if (filePath.empty())
+        return TextureHandle();
+
+    uint32_t id = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        auto it = m_ByPath.find(filePath);
+        if (it != m_ByPath.end())
+        {
+            // Liberada por falta de uso: volver a decodificarla con el mismo id
+            if (m_Entries[it->second - 1].state == State::EVICTED)
+                Redecode(it->second);
+            return TextureHandle{it->second};
+        }
+        else
+        {
+            Entry entry;
+            entry.path = filePath;
+            if (m_Headless)
+                entry.state = State::FAILED;
+            else if (atlas && m_AtlasPageSize > 0 && !m_AtlasBuilt)
+            {
+                entry.atlas = true;
+                ++m_AtlasDecoding;
+            }
+            m_Entries.push_back(std::move(entry));
+            id = static_cast<uint32_t>(m_Entries.size());
+            m_ByPath.emplace(filePath, id);
+
+            if (m_Headless)
+                return TextureHandle{id};
+        }
+
+        m_DecodeQueue.push_back(id);
+        ++m_PendingCount;
+    }
+    m_DecodeWork.notify_one();
+
+    return TextureHandle{id};
+}
+
+TextureRef AssetLoader::Acquire(const std::string &filePath)
+{
+    TextureHandle handle = RequestTexture(filePath);
+    if (!handle.IsValid())
+        return TextureRef();
+
+    // Sumar y revisar el estado bajo el mismo lock: entre RequestTexture y aquí
+    // ProcessUploads pudo liberarla si ya no tenía referencias
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        Entry &entry = m_Entries[handle.id - 1];
+        if (entry.state == State::EVICTED)
+            Redecode(handle.id);
+        ++entry.refs;
+        entry.acquired = true;
+    }
+    return TextureRef(*this, handle);
+}
+
+void AssetLoader::AddRef(TextureHandle handle)
+{
+    if (!handle.IsValid())
+        return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Entry &entry = m_Entries[handle.id - 1];
+    ++entry.refs;
+    entry.acquired = true;
+}
+
+void AssetLoader::Release(TextureHandle handle)
+{
+    if (!handle.IsValid())
+        return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    Entry &entry = m_Entries[handle.id - 1];
+    if (entry.refs > 0 && --entry.refs == 0)
+        entry.unusedSinceNs = SDL_GetTicksNS();
+}
+
+void AssetLoader::SetUnusedGrace(float seconds)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_UnusedGrace = seconds;
+}
+
+bool AssetLoader::IsDone(TextureHandle handle)
+{
+    if (!handle.IsValid())
+        return true;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    State state = m_Entries[handle.id - 1].state;
+
+    // Liberada pero todavía se necesita: pedirla de nuevo, no está lista
+    if (state == State::EVICTED)
+        Redecode(handle.id);
+    return state == State::READY || state == State::FAILED;
+}
+
+void AssetLoader::Wait(TextureHandle handle)
+{
+    if (!handle.IsValid())
+        return;
+
+    const bool mainThread = SDL_IsMainThread();
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        const Entry &entry = m_Entries[handle.id - 1];
+        if (entry.state == State::READY || entry.state == State::FAILED)
+            return;
+
+        if (entry.state == State::EVICTED)
+        {
+            Redecode(handle.id);
+            continue;
+        }
+
+        // En el hilo principal no hay nadie más que la suba: hacerlo ya
+        if (entry.state == State::DECODED && mainThread)
+        {
+            Upload(handle.id, lock);
+            continue;
+        }
+
+        m_Progress.wait(lock);
+    }
+}
+
+void AssetLoader::WaitForAll()
+{
+    const bool mainThread = SDL_IsMainThread();
+
+    // Los sprites de atlas solo terminan al empaquetarse
+    if (mainThread)
+        BuildAtlas();
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (m_PendingCount > 0)
+    {
+        if (mainThread && !m_UploadQueue.empty())
+        {
+            uint32_t id = m_UploadQueue.front();
+            m_UploadQueue.pop_front();
+            if (m_Entries[id - 1].state == State::DECODED)
+                Upload(id, lock);
+            continue;
+        }
+
+        m_Progress.wait(lock);
+    }
+}
+
+size_t AssetLoader::GetPendingCount() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_PendingCount;
+}
+
+int AssetLoader::ProcessUploads()
+{
+    int uploaded = 0;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    // Renderer diferido aún sin adjuntar: las superficies esperan en DECODED
+    if (!m_Renderer)
+        return 0;
+
+    while (!m_UploadQueue.empty() && (m_MaxUploadsPerFrame <= 0 || uploaded < m_MaxUploadsPerFrame))
+    {
+        uint32_t id = m_UploadQueue.front();
+        m_UploadQueue.pop_front();
+
+        // Wait() pudo subirla antes
+        if (m_Entries[id - 1].state != State::DECODED)
+            continue;
+
+        Upload(id, lock);
+        ++uploaded;
+    }
+
+    if (m_UnusedGrace >= 0.0f)
+        EvictUnused();
+    return uploaded;
+}
+
+void AssetLoader::ConfigureAtlas(int pageSize)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    m_AtlasPageSize = pageSize;
+}
+
+void AssetLoader::BuildAtlas()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    if (m_AtlasBuilt || m_AtlasPageSize <= 0 || !m_Renderer)
+        return;
+
+    m_Progress.wait(lock, [this]()
+                    { return m_AtlasDecoding == 0; });
+    m_AtlasBuilt = true;
+
+    // ========================================
+    // EMPAQUETAR (de mayor a menor altura: menos huecos en los estantes)
+    // ========================================
+    std::vector<uint32_t> ids;
+    for (uint32_t id = 1; id <= m_Entries.size(); ++id)
+    {
+        const Entry &entry = m_Entries[id - 1];
+        if (entry.atlas && entry.state == State::DECODED)
+            ids.push_back(id);
+    }
+    if (ids.empty())
+        return;
+
+    std::sort(ids.begin(), ids.end(), [this](uint32_t a, uint32_t b)
+              { return m_Entries[a - 1].surface->h > m_Entries[b - 1].surface->h; });
+
+    AtlasPacker packer(m_AtlasPageSize, 1);
+    std::vector<AtlasPacker::Placement> placements;
+    placements.reserve(ids.size());
+    for (uint32_t id : ids)
+    {
+        const SDL_Surface *surface = m_Entries[id - 1].surface;
+        placements.push_back(packer.Insert(surface->w, surface->h));
+    }
+
+    // ========================================
+    // COPIAR PÍXELES A UNA SUPERFICIE POR PÁGINA (recortada al área usada)
+    // ========================================
+    std::vector<SDL_Surface *> pages;
+    for (int p = 0; p < packer.GetPageCount(); ++p)
+        pages.push_back(SDL_CreateSurface(packer.GetUsedWidth(p), packer.GetUsedHeight(p), SDL_PIXELFORMAT_RGBA32));
+
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        Entry &entry = m_Entries[ids[i] - 1];
+        const AtlasPacker::Placement &placement = placements[i];
+
+        // No cabe en una página (o falló la superficie): se sube suelta como siempre
+        if (placement.page < 0 || !pages[placement.page])
+        {
+            entry.atlas = false;
+            m_UploadQueue.push_back(ids[i]);
+            continue;
+        }
+
+        // Copia literal (sin mezclar con el fondo transparente de la página)
+        SDL_Rect dst{placement.x, placement.y, entry.surface->w, entry.surface->h};
+        SDL_SetSurfaceBlendMode(entry.surface, SDL_BLENDMODE_NONE);
+        SDL_BlitSurface(entry.surface, nullptr, pages[placement.page], &dst);
+    }
+
+    // ========================================
+    // SUBIR LAS PÁGINAS Y APUNTAR CADA ENTRADA A SU RECTÁNGULO
+    // ========================================
+    for (SDL_Surface *page : pages)
+    {
+        SDL_Texture *texture = page ? SDL_CreateTextureFromSurface(m_Renderer, page) : nullptr;
+        if (!texture)
+            spdlog::error("AssetLoader: Error al crear una página de atlas: {}", SDL_GetError());
+        m_AtlasPages.push_back(texture);
+        if (page)
+            SDL_DestroySurface(page);
+    }
+
+    size_t packed = 0;
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        Entry &entry = m_Entries[ids[i] - 1];
+        if (!entry.atlas)
+            continue;
+
+        const AtlasPacker::Placement &placement = placements[i];
+        SDL_Texture *page = m_AtlasPages[placement.page];
+        entry.source = SDL_FRect{static_cast<float>(placement.x), static_cast<float>(placement.y),
+                                 static_cast<float>(entry.surface->w), static_cast<float>(entry.surface->h)};
+        SDL_DestroySurface(entry.surface);
+        entry.surface = nullptr;
+        entry.texture = page;
+        entry.inAtlas = page != nullptr;
+        entry.state = page ? State::READY : State::FAILED;
+        --m_PendingCount;
+        ++packed;
+    }
+    m_Progress.notify_all();
+
+    spdlog::info("AssetLoader: Atlas con {} sprites en {} página(s)", packed, m_AtlasPages.size());
+    for (int p = 0; p < packer.GetPageCount(); ++p)
+        spdlog::info("  Página {}: {}x{}", p, packer.GetUsedWidth(p), packer.GetUsedHeight(p));
+}
+
+void AssetLoader::EvictUnused()
+{
+    const Uint64 now = SDL_GetTicksNS();
+    const Uint64 graceNs = static_cast<Uint64>(static_cast<double>(m_UnusedGrace) * 1e9);
+
+    for (Entry &entry : m_Entries)
+    {
+        // Sin Acquire desde que se pidió (RequestTexture suelto) el reloj no ha empezado
+        if (entry.state != State::READY || entry.inAtlas || !entry.acquired || entry.refs > 0 ||
+            now - entry.unusedSinceNs < graceNs)
+            continue;
+
+        // Resolve() corre en este mismo hilo: ningún dibujo ve la textura destruida
+        SDL_DestroyTexture(entry.texture);
+        entry.texture = nullptr;
+        entry.state = State::EVICTED;
+        spdlog::info("AssetLoader: Textura liberada (sin referencias): {}", entry.path);
+    }
+}
+
+SDL_Texture *AssetLoader::Resolve(TextureHandle handle) const
+{
+    if (!handle.IsValid())
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    const Entry &entry = m_Entries[handle.id - 1];
+    switch (entry.state)
+    {
+    case State::READY:
+        return entry.texture;
+    case State::FAILED:
+    case State::EVICTED:
+        return nullptr;
+    default:
+        return m_Placeholder;
+    }
+}
+
+TextureRegion AssetLoader::ResolveRegion(TextureHandle handle) const
+{
+    if (!handle.IsValid())
+        return TextureRegion();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return RegionOf(handle.id);
+}
+
+void AssetLoader::ResolveRegions(const std::vector<TextureHandle> &handles, std::vector<TextureRegion> &regions) const
+{
+    regions.resize(handles.size());
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (size_t i = 0; i < handles.size(); ++i)
+        regions[i] = handles[i].IsValid() ? RegionOf(handles[i].id) : TextureRegion();
+}
+
+TextureRegion AssetLoader::RegionOf(uint32_t id) const
+{
+    TextureRegion region;
+    const Entry &entry = m_Entries[id - 1];
+    switch (entry.state)
+    {
+    case State::READY:
+        region.texture = entry.texture;
+        region.source = entry.source;
+        region.hasSource = entry.inAtlas;
+        break;
+    case State::FAILED:
+    case State::EVICTED:
+        break;
+    default:
+        region.texture = m_Placeholder;
+        break;
+    }
+    return region;
+}
+
+void AssetLoader::Redecode(uint32_t id)
+{
+    Entry &entry = m_Entries[id - 1];
+    entry.state = State::DECODING;
+    entry.acquired = false;
+    m_DecodeQueue.push_back(id);
+    ++m_PendingCount;
+    m_DecodeWork.notify_one();
+}
+
+void AssetLoader::Upload(uint32_t id, std::unique_lock<std::mutex> &lock)
+{
+    // Solo el hilo principal sube: la entrada sigue en DECODED mientras se suelta el lock.
+    // Sin lock no se toca la entrada (como en DecodeLoop): superficie y ruta se copian antes
+    SDL_Surface *surface = m_Entries[id - 1].surface;
+    m_Entries[id - 1].surface = nullptr;
+    std::string path = m_Entries[id - 1].path;
+
+    lock.unlock();
+    SDL_Texture *texture = m_Renderer ? SDL_CreateTextureFromSurface(m_Renderer, surface) : nullptr;
+    if (!texture)
+        spdlog::error("AssetLoader: Error al subir la textura: {} - SDL_Error: {}", path, SDL_GetError());
+    SDL_DestroySurface(surface);
+    lock.lock();
+
+    Entry &entry = m_Entries[id - 1];
+    entry.texture = texture;
+    entry.state = texture ? State::READY : State::FAILED;
+    --m_PendingCount;
+    m_Progress.notify_all();
+}
+
+void AssetLoader::DecodeLoop()
+{
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    while (true)
+    {
+        m_DecodeWork.wait(lock, [this]()
+                          { return m_Stop || !m_DecodeQueue.empty(); });
+        if (m_Stop)
+            return;
+
+        uint32_t id = m_DecodeQueue.front();
+        m_DecodeQueue.pop_front();
+        std::string path = m_Entries[id - 1].path;
+
+        // Decodificar sin el lock: es la parte cara (lectura de disco + PNG)
+        lock.unlock();
+        SDL_Surface *surface = IMG_Load(path.c_str());
+        if (!surface)
+            spdlog::error("AssetLoader: Error al cargar la textura: {} - SDL_Error: {}", path, SDL_GetError());
+        lock.lock();
+
+        Entry &entry = m_Entries[id - 1];
+        if (entry.atlas)
+            --m_AtlasDecoding;
+
+        if (surface)
+        {
+            entry.surface = surface;
+            entry.state = State::DECODED;
+            // Los sprites de atlas esperan a BuildAtlas en lugar de subirse sueltos
+            if (!entry.atlas)
+                m_UploadQueue.push_back(id);
+        }
+        else
+        {
+            entry.state = State::FAILED;
+            --m_PendingCount;
+        }
+        m_Progress.notify_all();
+    }
+}
+
+// ========================================
+// TextureRef
+// ========================================
+TextureRef::TextureRef(AssetLoader &assets, TextureHandle handle)
+    : m_Assets(&assets), m_Handle(handle)
+{
+}
+
+TextureRef::TextureRef(const TextureRef &other)
+    : m_Assets(other.m_Assets), m_Handle(other.m_Handle)
+{
+    if (m_Assets)
+        m_Assets->AddRef(m_Handle);
+}
+
+TextureRef::TextureRef(TextureRef &&other) noexcept
+    : m_Assets(other.m_Assets), m_Handle(other.m_Handle)
+{
+    other.m_Assets = nullptr;
+    other.m_Handle = TextureHandle();
+}
+
+TextureRef &TextureRef::operator=(TextureRef other) noexcept
+{
+    std::swap(m_Assets, other.m_Assets);
+    std::swap(m_Handle, other.m_Handle);
+    return *this;
+}
+
+TextureRef::~TextureRef()
+{
+    if (m_Assets)
+        m_Assets->Release(m_Handle);
+}
@@ -0,0 +1,79 @@
+#include "AtlasPacker.h"
+#include <algorithm>
+
+AtlasPacker::AtlasPacker(int pageSize, int padding)
+    : m_PageSize(std::max(1, pageSize)), m_Padding(std::max(0, padding))
+{
+}
+
+AtlasPacker::Placement AtlasPacker::Insert(int width, int height)
+{
+    const int paddedW = width + 2 * m_Padding;
+    const int paddedH = height + 2 * m_Padding;
+    if (width <= 0 || height <= 0 || paddedW > m_PageSize || paddedH > m_PageSize)
+        return Placement();
+
+    // ========================================
+    // ESTANTE EXISTENTE CON MENOS ALTURA DESPERDICIADA
+    // ========================================
+    int bestPage = -1;
+    int bestShelf = -1;
+    int bestWaste = m_PageSize + 1;
+    for (int p = 0; p < GetPageCount(); ++p)
+    {
+        const Page &page = m_Pages[p];
+        for (int s = 0; s < static_cast<int>(page.shelves.size()); ++s)
+        {
+            const Shelf &shelf = page.shelves[s];
+            if (shelf.height < paddedH || shelf.cursor + paddedW > m_PageSize)
+                continue;
+
+            int waste = shelf.height - paddedH;
+            if (waste < bestWaste)
+            {
+                bestWaste = waste;
+                bestPage = p;
+                bestShelf = s;
+            }
+        }
+    }
+
+    // ========================================
+    // SI NO HAY: ESTANTE NUEVO (EN LA PRIMERA PÁGINA CON SITIO, O PÁGINA NUEVA)
+    // ========================================
+    if (bestPage < 0)
+    {
+        for (int p = 0; p < GetPageCount() && bestPage < 0; ++p)
+        {
+            Page &page = m_Pages[p];
+            int top = page.shelves.empty() ? 0 : page.shelves.back().y + page.shelves.back().height;
+            if (top + paddedH <= m_PageSize)
+            {
+                page.shelves.push_back(Shelf{top, paddedH, 0});
+                bestPage = p;
+                bestShelf = static_cast<int>(page.shelves.size()) - 1;
+            }
+        }
+
+        if (bestPage < 0)
+        {
+            m_Pages.emplace_back();
+            m_Pages.back().shelves.push_back(Shelf{0, paddedH, 0});
+            bestPage = GetPageCount() - 1;
+            bestShelf = 0;
+        }
+    }
+
+    Page &page = m_Pages[bestPage];
+    Shelf &shelf = page.shelves[bestShelf];
+
+    Placement placement;
+    placement.page = bestPage;
+    placement.x = shelf.cursor + m_Padding;
+    placement.y = shelf.y + m_Padding;
+
+    shelf.cursor += paddedW;
+    page.usedWidth = std::max(page.usedWidth, shelf.cursor);
+    page.usedHeight = std::max(page.usedHeight, shelf.y + shelf.height);
+    return placement;
+}
@@ -0,0 +1,146 @@
+#include "BehaviorTable.h"
+#include <spdlog/spdlog.h>
+#include <unordered_map>
+
+namespace
+{
+    bool ParseAction(const std::string &name, BehaviorAction &out)
+    {
+        static const std::unordered_map<std::string, BehaviorAction> actions = {
+            {"chase", BehaviorAction::Chase},
+            {"wander", BehaviorAction::Wander},
+            {"flee", BehaviorAction::Flee},
+            {"orbit", BehaviorAction::Orbit},
+            {"dash", BehaviorAction::Dash},
+            {"idle", BehaviorAction::Idle}};
+
+        auto it = actions.find(name);
+        if (it == actions.end())
+            return false;
+        out = it->second;
+        return true;
+    }
+
+    bool ParseCondition(const std::string &name, BehaviorCondition &out)
+    {
+        static const std::unordered_map<std::string, BehaviorCondition> conditions = {
+            {"player_within", BehaviorCondition::PlayerWithin},
+            {"player_beyond", BehaviorCondition::PlayerBeyond},
+            {"time_in_state", BehaviorCondition::TimeInState}};
+
+        auto it = conditions.find(name);
+        if (it == conditions.end())
+            return false;
+        out = it->second;
+        return true;
+    }
+}
+
+uint16_t BehaviorTable::AddType(const std::string &typeName, const TypeDef &def)
+{
+    const uint16_t base = static_cast<uint16_t>(m_States.size());
+
+    // Sin definición: un único estado de persecución (comportamiento clásico)
+    if (def.states.empty())
+    {
+        m_States.push_back({BehaviorAction::Chase, 1.0f, 0.0f, 0.0f,
+                            static_cast<uint16_t>(m_Transitions.size()), 0});
+        return base;
+    }
+
+    // ========================================
+    // PASO 1: Nombres locales -> ids globales
+    // ========================================
+    std::unordered_map<std::string, uint16_t> ids;
+    for (size_t i = 0; i < def.states.size(); ++i)
+        ids[def.states[i].name] = static_cast<uint16_t>(base + i);
+
+    // ========================================
+    // PASO 2: Tabla de estados
+    // ========================================
+    for (const StateDef &stateDef : def.states)
+    {
+        BehaviorAction action = BehaviorAction::Chase;
+        if (!ParseAction(stateDef.action, action))
+            spdlog::warn("BehaviorTable: {} - acción desconocida '{}' en estado '{}', se usa 'chase'",
+                         typeName, stateDef.action, stateDef.name);
+
+        m_States.push_back({action, stateDef.speedScale, stateDef.radius, stateDef.turnRate, 0, 0});
+    }
+
+    // ========================================
+    // PASO 3: Transiciones agrupadas por estado origen (orden del JSON)
+    // ========================================
+    for (size_t i = 0; i < def.states.size(); ++i)
+    {
+        BehaviorState &state = m_States[base + i];
+        state.firstTransition = static_cast<uint16_t>(m_Transitions.size());
+
+        for (const TransitionDef &transitionDef : def.transitions)
+        {
+            if (transitionDef.from != def.states[i].name)
+                continue;
+
+            auto target = ids.find(transitionDef.to);
+            BehaviorCondition condition;
+            if (target == ids.end() || !ParseCondition(transitionDef.when, condition))
+            {
+                spdlog::warn("BehaviorTable: {} - transición inválida {} -> {} ('{}'), descartada",
+                             typeName, transitionDef.from, transitionDef.to, transitionDef.when);
+                continue;
+            }
+
+            m_Transitions.push_back({condition, transitionDef.value,
+                                     transitionDef.value * transitionDef.value, target->second});
+        }
+
+        state.transitionCount = static_cast<uint16_t>(m_Transitions.size() - state.firstTransition);
+    }
+
+    for (const TransitionDef &transitionDef : def.transitions)
+    {
+        if (ids.find(transitionDef.from) == ids.end())
+            spdlog::warn("BehaviorTable: {} - transición desde estado inexistente '{}'",
+                         typeName, transitionDef.from);
+    }
+
+    auto initial = ids.find(def.initial);
+    if (initial == ids.end())
+    {
+        if (!def.initial.empty())
+            spdlog::warn("BehaviorTable: {} - estado inicial '{}' no existe, se usa '{}'",
+                         typeName, def.initial, def.states.front().name);
+        return base;
+    }
+
+    return initial->second;
+}
+
+uint16_t BehaviorTable::Evaluate(uint16_t state, float distanceSq, float timeInState) const
+{
+    const BehaviorState &current = m_States[state];
+    const BehaviorTransition *transition = m_Transitions.data() + current.firstTransition;
+    const BehaviorTransition *end = transition + current.transitionCount;
+
+    for (; transition != end; ++transition)
+    {
+        bool triggered = false;
+        switch (transition->condition)
+        {
+        case BehaviorCondition::PlayerWithin:
+            triggered = distanceSq <= transition->valueSq;
+            break;
+        case BehaviorCondition::PlayerBeyond:
+            triggered = distanceSq > transition->valueSq;
+            break;
+        case BehaviorCondition::TimeInState:
+            triggered = timeInState >= transition->value;
+            break;
+        }
+
+        if (triggered)
+            return transition->target;
+    }
+
+    return state;
+}
@@ -0,0 +1,216 @@
+#include "BitmapFont.h"
+#include "SpriteBatch.h"
+#include <spdlog/spdlog.h>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+    /**
+     * @brief Glifo precocinado: 7 filas de 5 bits (bit 4 = columna izquierda)
+     */
+    struct GlyphDef
+    {
+        char c;
+        uint8_t rows[BitmapFont::GLYPH_HEIGHT];
+    };
+
+    const GlyphDef GLYPHS[] = {
+        {' ', {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+        {'%', {0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03}},
+        {'(', {0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02}},
+        {')', {0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08}},
+        {'-', {0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00}},
+        {'.', {0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C}},
+        {'/', {0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00}},
+        {'0', {0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E}},
+        {'1', {0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+        {'2', {0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F}},
+        {'3', {0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E}},
+        {'4', {0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02}},
+        {'5', {0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E}},
+        {'6', {0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E}},
+        {'7', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08}},
+        {'8', {0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E}},
+        {'9', {0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C}},
+        {':', {0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00}},
+        {'A', {0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+        {'B', {0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E}},
+        {'C', {0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E}},
+        {'D', {0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C}},
+        {'E', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F}},
+        {'F', {0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10}},
+        {'G', {0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F}},
+        {'H', {0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11}},
+        {'I', {0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E}},
+        {'J', {0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C}},
+        {'K', {0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11}},
+        {'L', {0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F}},
+        {'M', {0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11}},
+        {'N', {0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11}},
+        {'O', {0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+        {'P', {0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10}},
+        {'Q', {0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D}},
+        {'R', {0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11}},
+        {'S', {0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E}},
+        {'T', {0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}},
+        {'U', {0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E}},
+        {'V', {0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04}},
+        {'W', {0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A}},
+        {'X', {0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11}},
+        {'Y', {0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04}},
+        {'Z', {0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F}},
+    };
+
+    const int CELL_WIDTH = BitmapFont::GLYPH_WIDTH + 2;   // 1 píxel de margen a cada lado
+    const int CELL_HEIGHT = BitmapFont::GLYPH_HEIGHT + 2; // (evita sangrado entre glifos)
+    const int ATLAS_COLUMNS = 16;
+}
+
+// ========================================
+// BitmapFont
+// ========================================
+BitmapFont::BitmapFont()
+    : m_Texture(nullptr), m_Glyphs(), m_HasGlyph()
+{
+}
+
+BitmapFont::~BitmapFont()
+{
+    if (m_Texture)
+        SDL_DestroyTexture(m_Texture);
+}
+
+bool BitmapFont::Load(SDL_Renderer *renderer)
+{
+    if (m_Texture)
+        return true;
+    if (!renderer)
+        return false;
+
+    const int glyphCount = static_cast<int>(sizeof(GLYPHS) / sizeof(GLYPHS[0]));
+    const int atlasWidth = ATLAS_COLUMNS * CELL_WIDTH;
+    const int atlasHeight = ((glyphCount + ATLAS_COLUMNS - 1) / ATLAS_COLUMNS) * CELL_HEIGHT;
+
+    SDL_Surface *surface = SDL_CreateSurface(atlasWidth, atlasHeight, SDL_PIXELFORMAT_RGBA32);
+    if (!surface)
+    {
+        spdlog::error("BitmapFont: no se pudo crear la superficie del atlas: {}", SDL_GetError());
+        return false;
+    }
+
+    // Blanco opaco donde hay bit, transparente en el resto (el color lo ponen los vértices)
+    SDL_FillSurfaceRect(surface, nullptr, 0);
+    const Uint32 white = SDL_MapSurfaceRGBA(surface, 255, 255, 255, 255);
+
+    for (int i = 0; i < glyphCount; ++i)
+    {
+        const GlyphDef &glyph = GLYPHS[i];
+        const int cellX = (i % ATLAS_COLUMNS) * CELL_WIDTH + 1;
+        const int cellY = (i / ATLAS_COLUMNS) * CELL_HEIGHT + 1;
+
+        for (int row = 0; row < GLYPH_HEIGHT; ++row)
+        {
+            for (int col = 0; col < GLYPH_WIDTH; ++col)
+            {
+                if (glyph.rows[row] & (1 << (GLYPH_WIDTH - 1 - col)))
+                {
+                    SDL_Rect pixel{cellX + col, cellY + row, 1, 1};
+                    SDL_FillSurfaceRect(surface, &pixel, white);
+                }
+            }
+        }
+
+        const unsigned char index = static_cast<unsigned char>(glyph.c);
+        m_Glyphs[index] = SDL_FRect{static_cast<float>(cellX) / atlasWidth, static_cast<float>(cellY) / atlasHeight,
+                                    static_cast<float>(GLYPH_WIDTH) / atlasWidth,
+                                    static_cast<float>(GLYPH_HEIGHT) / atlasHeight};
+        m_HasGlyph[index] = true;
+    }
+
+    m_Texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_DestroySurface(surface);
+    if (!m_Texture)
+    {
+        spdlog::error("BitmapFont: no se pudo crear la textura del atlas: {}", SDL_GetError());
+        return false;
+    }
+
+    // Píxeles nítidos al escalar
+    SDL_SetTextureScaleMode(m_Texture, SDL_SCALEMODE_NEAREST);
+    SDL_SetTextureBlendMode(m_Texture, SDL_BLENDMODE_BLEND);
+
+    spdlog::info("BitmapFont: atlas de {} glifos ({}x{})", glyphCount, atlasWidth, atlasHeight);
+    return true;
+}
+
+bool BitmapFont::GetGlyph(char c, SDL_FRect &uv) const
+{
+    const unsigned char index = static_cast<unsigned char>(std::toupper(static_cast<unsigned char>(c)));
+    if (index >= 128 || !m_HasGlyph[index])
+        return false;
+
+    uv = m_Glyphs[index];
+    return true;
+}
+
+float BitmapFont::Measure(const char *text, float scale) const
+{
+    const size_t length = std::strlen(text);
+    if (length == 0)
+        return 0.0f;
+
+    // El último carácter no suma el espacio entre glifos
+    return (static_cast<float>(length) * ADVANCE - (ADVANCE - GLYPH_WIDTH)) * scale;
+}
+
+// ========================================
+// TextBlock
+// ========================================
+bool TextBlock::Set(const BitmapFont &font, const char *text, float x, float y, float scale, SDL_FColor color)
+{
+    if (m_Scale == scale && m_X == x && m_Y == y && text == m_Text && m_Color.r == color.r &&
+        m_Color.g == color.g && m_Color.b == color.b && m_Color.a == color.a)
+        return false;
+
+    m_Text.assign(text); // Conserva la capacidad: sin reservas en el caso habitual
+    m_X = x;
+    m_Y = y;
+    m_Scale = scale;
+    m_Color = color;
+    m_Width = font.Measure(m_Text.c_str(), scale);
+
+    m_Vertices.clear();
+    m_Indices.clear();
+
+    const float glyphW = BitmapFont::GLYPH_WIDTH * scale;
+    const float glyphH = BitmapFont::GLYPH_HEIGHT * scale;
+    float penX = x;
+
+    for (char c : m_Text)
+    {
+        SDL_FRect uv;
+        if (c != ' ' && font.GetGlyph(c, uv))
+        {
+            const int base = static_cast<int>(m_Vertices.size());
+            m_Vertices.push_back(SDL_Vertex{{penX, y}, color, {uv.x, uv.y}});
+            m_Vertices.push_back(SDL_Vertex{{penX + glyphW, y}, color, {uv.x + uv.w, uv.y}});
+            m_Vertices.push_back(SDL_Vertex{{penX + glyphW, y + glyphH}, color, {uv.x + uv.w, uv.y + uv.h}});
+            m_Vertices.push_back(SDL_Vertex{{penX, y + glyphH}, color, {uv.x, uv.y + uv.h}});
+            m_Indices.insert(m_Indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+        }
+        penX += BitmapFont::ADVANCE * scale;
+    }
+
+    return true;
+}
+
+void TextBlock::Draw(SpriteBatch &batch, const BitmapFont &font) const
+{
+    if (m_Indices.empty() || !font.IsLoaded())
+        return;
+
+    batch.AddGeometry(font.GetTexture(), m_Vertices.data(), static_cast<int>(m_Vertices.size()),
+                      m_Indices.data(), static_cast<int>(m_Indices.size()));
+}
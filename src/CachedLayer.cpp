@@ -0,0 +1,59 @@
+#include "CachedLayer.h"
+#include "SpriteBatch.h"
+#include <spdlog/spdlog.h>
+
+CachedLayer::CachedLayer(SDL_Renderer *renderer)
+    : m_Renderer(renderer), m_Texture(nullptr), m_Width(0), m_Height(0), m_Key(0), m_Valid(false),
+      m_Unsupported(false)
+{
+}
+
+CachedLayer::~CachedLayer()
+{
+    if (m_Texture)
+        SDL_DestroyTexture(m_Texture);
+}
+
+bool CachedLayer::Begin(SpriteBatch &batch, int width, int height)
+{
+    if (!m_Renderer || m_Unsupported || width <= 0 || height <= 0)
+        return false;
+
+    m_Valid = false;
+
+    if (!m_Texture || width != m_Width || height != m_Height)
+    {
+        if (m_Texture)
+            SDL_DestroyTexture(m_Texture);
+
+        m_Texture = SDL_CreateTexture(m_Renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!m_Texture)
+        {
+            spdlog::warn("CachedLayer: no se pudo crear el render target {}x{}: {} (se dibuja sin caché)",
+                         width, height, SDL_GetError());
+            m_Unsupported = true;
+            return false;
+        }
+
+        SDL_SetTextureBlendMode(m_Texture, SDL_BLENDMODE_BLEND);
+        m_Width = width;
+        m_Height = height;
+    }
+
+    // Lo pendiente pertenece al destino anterior
+    batch.Flush();
+
+    SDL_SetRenderTarget(m_Renderer, m_Texture);
+    SDL_SetRenderDrawColor(m_Renderer, 0, 0, 0, 0);
+    SDL_RenderClear(m_Renderer);
+    return true;
+}
+
+void CachedLayer::End(SpriteBatch &batch, uint64_t key)
+{
+    batch.Flush();
+    SDL_SetRenderTarget(m_Renderer, nullptr);
+
+    m_Key = key;
+    m_Valid = true;
+}
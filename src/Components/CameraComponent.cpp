@@ -0,0 +1,37 @@
+#include "../../include/Components/CameraComponent.h"
+
+CameraComponent::CameraComponent(float viewWidth, float viewHeight)
+    : Component(), m_Position(0.0f, 0.0f), m_PreviousPosition(0.0f, 0.0f), m_ViewSize(viewWidth, viewHeight)
+{
+    m_Type = "CameraComponent";
+}
+
+void CameraComponent::Follow(const glm::vec2 &previousCenter, const glm::vec2 &center, float worldWidth,
+                             float worldHeight)
+{
+    // Ambas posiciones salen de la entidad: la cámara interpola igual que su sprite (sin tirones)
+    m_PreviousPosition = Clamp(previousCenter, worldWidth, worldHeight);
+    m_Position = Clamp(center, worldWidth, worldHeight);
+}
+
+glm::vec2 CameraComponent::Clamp(const glm::vec2 &center, float worldWidth, float worldHeight) const
+{
+    glm::vec2 position = center - m_ViewSize * 0.5f;
+
+    // Mundo más pequeño que la vista: centrado (posición negativa = bandas alrededor)
+    if (worldWidth <= m_ViewSize.x)
+        position.x = (worldWidth - m_ViewSize.x) * 0.5f;
+    else if (position.x < 0.0f)
+        position.x = 0.0f;
+    else if (position.x > worldWidth - m_ViewSize.x)
+        position.x = worldWidth - m_ViewSize.x;
+
+    if (worldHeight <= m_ViewSize.y)
+        position.y = (worldHeight - m_ViewSize.y) * 0.5f;
+    else if (position.y < 0.0f)
+        position.y = 0.0f;
+    else if (position.y > worldHeight - m_ViewSize.y)
+        position.y = worldHeight - m_ViewSize.y;
+
+    return position;
+}
@@ -1,7 +1,8 @@
 #include "../../include/Components/EnemyComponent.h"
 
-EnemyComponent::EnemyComponent(float speed, float range, float smoothing)
-    : Component(), baseSpeed(speed), focusRange(range), velocitySmoothing(smoothing)
+EnemyComponent::EnemyComponent(float speed, float range, float smoothing, uint16_t initialState)
+    : Component(), baseSpeed(speed), focusRange(range), velocitySmoothing(smoothing),
+      aiAccumulatedTime(0.0f), behaviorState(initialState), stateTime(0.0f), heading(1.0f, 0.0f)
 {
     m_Type = "EnemyComponent";
 }
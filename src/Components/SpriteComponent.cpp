@@ -1,23 +1,15 @@
 #include "../../include/Components/SpriteComponent.h"
 #include <spdlog/spdlog.h>
 
-SpriteComponent::SpriteComponent(const std::string &filePath, SDL_Renderer *renderer)
-    : Component(), m_Texture(nullptr)
+SpriteComponent::SpriteComponent(const std::string &filePath, AssetLoader &assets)
+    : Component()
 {
     m_Type = "SpriteComponent";
-    // Cargar la textura usando SDL_image
-    m_Texture = IMG_LoadTexture(renderer, filePath.c_str());
-    if (!m_Texture)
+    // Pedir la textura: no bloquea, se dibuja un placeholder hasta que esté subida.
+    // La referencia mantiene viva la textura compartida mientras exista la entidad
+    m_Texture = assets.Acquire(filePath);
+    if (!m_Texture.IsValid())
     {
-        spdlog::error("SpriteComponent: Error al cargar la textura: {} - SDL_Error: {}", filePath, SDL_GetError());
-    }
-}
-
-SpriteComponent::~SpriteComponent()
-{ // Liberar la textura al destruir el componente
-    if (m_Texture)
-    {
-        SDL_DestroyTexture(m_Texture);
-        m_Texture = nullptr;
+        spdlog::error("SpriteComponent: Ruta de textura vacía");
     }
 }
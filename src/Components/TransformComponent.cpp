@@ -1,7 +1,7 @@
 #include "../../include/Components/TransformComponent.h"
 // Representa la posición y velocidad de una entidad
 TransformComponent::TransformComponent(float x, float y, float vx, float vy)
-    : Component(), m_Position(x, y), m_Velocity(vx, vy)
+    : Component(), m_Position(x, y), m_Velocity(vx, vy), m_PreviousPosition(x, y)
 {
     m_Type = "TransformComponent";
 }
@@ -1,4 +1,5 @@
 #include "ConfigLoader.h"
+#include "JobSystem.h"
 #include <fstream>
 #include <spdlog/spdlog.h>
 
@@ -21,20 +22,104 @@ bool ConfigLoader::LoadSettings(const std::string &path)
         m_Window.height = windowObj["height"];
         m_Window.title = windowObj.value("title", "Mega Man ECS Engine");
 
+        // Mundo: por defecto del tamaño de la ventana (la cámara no se mueve)
+        auto worldObj = settings.value("world", json::object());
+        m_World.width = worldObj.value("width", 0.0f);
+        m_World.height = worldObj.value("height", 0.0f);
+        if (m_World.width <= 0.0f)
+            m_World.width = m_Window.width;
+        if (m_World.height <= 0.0f)
+            m_World.height = m_Window.height;
+
         auto gameplayObj = settings.value("gameplay", json::object());
         m_Gameplay.playerSpeed = gameplayObj["player_speed"];
+        m_Gameplay.fixedTimestep = gameplayObj.value("fixed_timestep", true);
+        m_Gameplay.tickRate = gameplayObj.value("tick_rate", 60);
+        m_Gameplay.maxCatchUpSteps = gameplayObj.value("max_catch_up_steps", 5);
 
         auto collisionObj = settings.value("collision", json::object());
         m_Collision.playerPushStrength = collisionObj.value("player_push_strength", 10.0f);
         m_Collision.enemyPushStrength = collisionObj.value("enemy_push_strength", 10.0f);
         m_Collision.playerInvulnerabilityDuration = collisionObj.value("player_invulnerability_duration", 3.0f);
 
+        auto aiObj = settings.value("ai", json::object());
+        m_AI.flowFieldEnabled = aiObj.value("flow_field_enabled", true);
+        m_AI.flowFieldCellSize = aiObj.value("flow_field_cell_size", 40.0f);
+        m_AI.flowFieldClearance = aiObj.value("flow_field_clearance", 24.0f);
+        m_AI.lodEnabled = aiObj.value("lod_enabled", true);
+        m_AI.lodNearDistance = aiObj.value("lod_near_distance", 700.0f);
+        m_AI.lodFarInterval = aiObj.value("lod_far_interval", 4);
+        m_AI.maxUpdatesPerFrame = aiObj.value("max_updates_per_frame", 256);
+        m_AI.separationEnabled = aiObj.value("separation_enabled", true);
+        m_AI.separationRadius = aiObj.value("separation_radius", 100.0f);
+        m_AI.separationWeight = aiObj.value("separation_weight", 0.6f);
+        m_AI.cohesionWeight = aiObj.value("cohesion_weight", 0.0f);
+        m_AI.obstacleAvoidEnabled = aiObj.value("obstacle_avoid_enabled", true);
+        m_AI.obstacleAvoidDistance = aiObj.value("obstacle_avoid_distance", 60.0f);
+        m_AI.obstacleAvoidWeight = aiObj.value("obstacle_avoid_weight", 0.8f);
+
+        auto projectilesObj = settings.value("projectiles", json::object());
+        m_Projectiles.capacity = projectilesObj.value("capacity", 512);
+        m_Projectiles.speed = projectilesObj.value("speed", 900.0f);
+        m_Projectiles.lifetime = projectilesObj.value("lifetime", 1.2f);
+        m_Projectiles.damage = projectilesObj.value("damage", 1);
+        m_Projectiles.fireRate = projectilesObj.value("fire_rate", 10.0f);
+        m_Projectiles.width = projectilesObj.value("width", 16.0f);
+        m_Projectiles.height = projectilesObj.value("height", 8.0f);
+
+        auto threadingObj = settings.value("threading", json::object());
+        m_Threading.workerThreads = threadingObj.value("worker_threads", -1);
+        m_Threading.forceSerial = threadingObj.value("force_serial", false);
+
+        auto assetsObj = settings.value("assets", json::object());
+        m_Assets.decodeThreads = assetsObj.value("decode_threads", 1);
+        m_Assets.maxUploadsPerFrame = assetsObj.value("max_uploads_per_frame", 4);
+        m_Assets.prefetchLeadTime = assetsObj.value("prefetch_lead_time", 5.0f);
+        m_Assets.unusedTextureGrace = assetsObj.value("unused_texture_grace", -1.0f);
+        m_Assets.atlasPageSize = assetsObj.value("atlas_page_size", 2048);
+
+        auto renderObj = settings.value("render", json::object());
+        m_Render.batching = renderObj.value("batching", true);
+        m_Render.cacheLayers = renderObj.value("cache_layers", true);
+        m_Render.statsInterval = renderObj.value("stats_interval", 0.0f);
+
+        auto serverObj = settings.value("server", json::object());
+        m_Server.matches = serverObj.value("matches", 64);
+        m_Server.threads = serverObj.value("threads", -1);
+        m_Server.maxMatchTime = serverObj.value("max_match_time", 300.0f);
+        m_Server.seed = serverObj.value("seed", 1u);
+        m_Server.output = serverObj.value("output", std::string("match_results.json"));
+        m_Server.checkDeterminism = serverObj.value("check_determinism", false);
+
         spdlog::info("=== SETTINGS CARGADOS ===");
         spdlog::info("Window: {}x{}, Title: {}", (int)m_Window.width, (int)m_Window.height, m_Window.title);
+        spdlog::info("World: {}x{}", (int)m_World.width, (int)m_World.height);
         spdlog::info("Gameplay: PlayerSpeed={:.1f}", m_Gameplay.playerSpeed);
+        spdlog::info("Timestep: fixed={}, tickRate={}, maxCatchUp={}",
+                     m_Gameplay.fixedTimestep, m_Gameplay.tickRate, m_Gameplay.maxCatchUpSteps);
         spdlog::info("Collision: playerPush={:.1f}, enemyPush={:.1f}, invulnerability={:.1f}s",
                      m_Collision.playerPushStrength,
                      m_Collision.enemyPushStrength, m_Collision.playerInvulnerabilityDuration);
+        spdlog::info("AI: flowField={}, cellSize={:.1f}, clearance={:.1f}",
+                     m_AI.flowFieldEnabled, m_AI.flowFieldCellSize, m_AI.flowFieldClearance);
+        spdlog::info("AI LOD: enabled={}, nearDistance={:.1f}, farInterval={}, budget={}",
+                     m_AI.lodEnabled, m_AI.lodNearDistance, m_AI.lodFarInterval, m_AI.maxUpdatesPerFrame);
+        spdlog::info("AI Separation: enabled={}, radius={:.1f}, weight={:.2f}, cohesion={:.2f}",
+                     m_AI.separationEnabled, m_AI.separationRadius, m_AI.separationWeight, m_AI.cohesionWeight);
+        spdlog::info("AI Obstacle avoidance: enabled={}, distance={:.1f}, weight={:.2f}",
+                     m_AI.obstacleAvoidEnabled, m_AI.obstacleAvoidDistance, m_AI.obstacleAvoidWeight);
+        spdlog::info("Projectiles: capacity={}, speed={:.1f}, lifetime={:.2f}, damage={}, fireRate={:.1f}",
+                     m_Projectiles.capacity, m_Projectiles.speed, m_Projectiles.lifetime,
+                     m_Projectiles.damage, m_Projectiles.fireRate);
+        spdlog::info("Threading: workerThreads={}, forceSerial={}",
+                     m_Threading.workerThreads, m_Threading.forceSerial);
+        spdlog::info("Assets: decodeThreads={}, maxUploadsPerFrame={}, prefetchLeadTime={:.1f}s, unusedTextureGrace={:.1f}s, atlasPageSize={}",
+                     m_Assets.decodeThreads, m_Assets.maxUploadsPerFrame, m_Assets.prefetchLeadTime,
+                     m_Assets.unusedTextureGrace, m_Assets.atlasPageSize);
+        spdlog::info("Render: batching={}, cacheLayers={}, statsInterval={:.1f}s",
+                     m_Render.batching, m_Render.cacheLayers, m_Render.statsInterval);
+        spdlog::info("Server: matches={}, threads={}, maxMatchTime={:.1f}s, seed={}, output={}",
+                     m_Server.matches, m_Server.threads, m_Server.maxMatchTime, m_Server.seed, m_Server.output);
 
         return true;
     }
@@ -107,6 +192,7 @@ bool ConfigLoader::LoadEnemyConfig(const std::string &path)
         }
 
         m_EnemyEntity.enemyTypes.clear();
+        m_EnemyEntity.behaviors = BehaviorTable();
 
         for (const auto &enemyData : enemyJson["enemies"])
         {
@@ -121,11 +207,36 @@ bool ConfigLoader::LoadEnemyConfig(const std::string &path)
             enemyType.velocitySmoothing = enemyData["ai"]["velocity_smoothing"].get<float>();
             enemyType.lifetime = enemyData.value("lifetime", 0.0f);
 
+            // Máquina de estados opcional (sin "behavior" = persecución clásica)
+            auto behaviorObj = enemyData.value("behavior", json::object());
+            enemyType.behavior.initial = behaviorObj.value("initial", std::string());
+            for (const auto &stateData : behaviorObj.value("states", json::array()))
+            {
+                BehaviorTable::StateDef state;
+                state.name = stateData.value("name", std::string());
+                state.action = stateData.value("action", std::string("chase"));
+                state.speedScale = stateData.value("speed_scale", 1.0f);
+                state.radius = stateData.value("radius", 150.0f);
+                state.turnRate = stateData.value("turn_rate", 2.0f);
+                enemyType.behavior.states.push_back(state);
+            }
+            for (const auto &transitionData : behaviorObj.value("transitions", json::array()))
+            {
+                BehaviorTable::TransitionDef transition;
+                transition.from = transitionData.value("from", std::string());
+                transition.to = transitionData.value("to", std::string());
+                transition.when = transitionData.value("when", std::string());
+                transition.value = transitionData.value("value", 0.0f);
+                enemyType.behavior.transitions.push_back(transition);
+            }
+            enemyType.initialBehaviorState = m_EnemyEntity.behaviors.AddType(enemyType.name, enemyType.behavior);
+
             m_EnemyEntity.enemyTypes.push_back(enemyType);
         }
 
         spdlog::info("=== ENEMY CONFIG CARGADA ===");
         spdlog::info("Tipos de enemigos disponibles: {}", m_EnemyEntity.enemyTypes.size());
+        spdlog::info("Estados de comportamiento compilados: {}", m_EnemyEntity.behaviors.GetStateCount());
 
         return true;
     }
@@ -209,6 +320,44 @@ bool ConfigLoader::LoadWavesConfig(const std::string &path)
     }
 }
 
+bool ConfigLoader::LoadGameConfigs(JobSystem *jobs)
+{
+    bool playerOk = false;
+    bool enemiesOk = false;
+    bool wavesOk = false;
+
+    // Un trabajo por archivo: secciones disjuntas, sin estado compartido
+    JobSystem::Job loads[] = {
+        [this, &playerOk]()
+        { playerOk = LoadPlayerConfig(); },
+        [this, &enemiesOk]()
+        { enemiesOk = LoadEnemyConfig(); },
+        [this, &wavesOk]()
+        { wavesOk = LoadWavesConfig(); },
+        [this]()
+        { LoadObstacleConfig(); },
+        [this]()
+        { LoadObstaclesByPhaseConfig(); }};
+
+    if (jobs)
+    {
+        JobCounter counter;
+        for (auto &load : loads)
+            jobs->Submit(load, counter);
+        jobs->Wait(counter);
+    }
+    else
+    {
+        for (auto &load : loads)
+            load();
+    }
+
+    if (!wavesOk)
+        spdlog::error("No se pudo cargar la configuración de oleadas");
+
+    return playerOk && enemiesOk && wavesOk;
+}
+
 void ConfigLoader::CalculatePlayerSpawnPosition(float worldWidth, float worldHeight)
 {
     m_PlayerEntity.CalculateSpawnPosition(worldWidth, worldHeight);
@@ -0,0 +1,113 @@
+#include "DistanceField.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    // Distancia con signo de un punto a un rectángulo (negativa dentro)
+    float RectDistance(const glm::vec2 &point, const glm::vec4 &rect)
+    {
+        const glm::vec2 halfSize(rect.z * 0.5f, rect.w * 0.5f);
+        const glm::vec2 center(rect.x + halfSize.x, rect.y + halfSize.y);
+        const glm::vec2 q = glm::abs(point - center) - halfSize;
+
+        const float outside = glm::length(glm::max(q, glm::vec2(0.0f)));
+        const float inside = std::min(std::max(q.x, q.y), 0.0f);
+        return outside + inside;
+    }
+}
+
+void DistanceField::Build(float worldWidth, float worldHeight, float cellSize, const std::vector<glm::vec4> &rects)
+{
+    if (rects.empty())
+    {
+        Clear();
+        return;
+    }
+
+    m_CellSize = std::max(1.0f, cellSize);
+    m_Cols = static_cast<int>(std::ceil(worldWidth / m_CellSize)) + 1;
+    m_Rows = static_cast<int>(std::ceil(worldHeight / m_CellSize)) + 1;
+    m_Distances.assign(static_cast<size_t>(m_Cols) * m_Rows, std::numeric_limits<float>::max());
+
+    for (int row = 0; row < m_Rows; ++row)
+    {
+        for (int col = 0; col < m_Cols; ++col)
+        {
+            const glm::vec2 node(col * m_CellSize, row * m_CellSize);
+            float &distance = m_Distances[row * m_Cols + col];
+            for (const glm::vec4 &rect : rects)
+                distance = std::min(distance, RectDistance(node, rect));
+        }
+    }
+}
+
+void DistanceField::Clear()
+{
+    m_Distances.clear();
+    m_Cols = 0;
+    m_Rows = 0;
+}
+
+glm::vec2 DistanceField::ClampToGrid(const glm::vec2 &position) const
+{
+    return glm::vec2(std::clamp(position.x, 0.0f, (m_Cols - 1) * m_CellSize),
+                     std::clamp(position.y, 0.0f, (m_Rows - 1) * m_CellSize));
+}
+
+void DistanceField::Locate(const glm::vec2 &position, int &col, int &row, float &fx, float &fy) const
+{
+    const float gx = position.x / m_CellSize;
+    const float gy = position.y / m_CellSize;
+    col = std::min(static_cast<int>(gx), std::max(0, m_Cols - 2));
+    row = std::min(static_cast<int>(gy), std::max(0, m_Rows - 2));
+    fx = gx - col;
+    fy = gy - row;
+}
+
+float DistanceField::Sample(const glm::vec2 &position) const
+{
+    if (m_Distances.empty())
+        return std::numeric_limits<float>::max();
+
+    const glm::vec2 clamped = ClampToGrid(position);
+    int col, row;
+    float fx, fy;
+    Locate(clamped, col, row, fx, fy);
+
+    const int nextCol = std::min(col + 1, m_Cols - 1);
+    const int nextRow = std::min(row + 1, m_Rows - 1);
+    const float top = At(col, row) + (At(nextCol, row) - At(col, row)) * fx;
+    const float bottom = At(col, nextRow) + (At(nextCol, nextRow) - At(col, nextRow)) * fx;
+    const float distance = top + (bottom - top) * fy;
+
+    // Fuera de la rejilla: cota inferior (el campo es 1-Lipschitz)
+    return distance - glm::length(position - clamped);
+}
+
+glm::vec2 DistanceField::Gradient(const glm::vec2 &position) const
+{
+    if (m_Distances.empty())
+        return glm::vec2(0.0f);
+
+    int col, row;
+    float fx, fy;
+    Locate(ClampToGrid(position), col, row, fx, fy);
+
+    const int nextCol = std::min(col + 1, m_Cols - 1);
+    const int nextRow = std::min(row + 1, m_Rows - 1);
+    const float d00 = At(col, row);
+    const float d10 = At(nextCol, row);
+    const float d01 = At(col, nextRow);
+    const float d11 = At(nextCol, nextRow);
+
+    // Derivadas del interpolante bilineal dentro de la celda
+    const glm::vec2 gradient((d10 - d00) * (1.0f - fy) + (d11 - d01) * fy,
+                             (d01 - d00) * (1.0f - fx) + (d11 - d10) * fx);
+
+    const float length = glm::length(gradient);
+    if (length < 1e-6f)
+        return glm::vec2(0.0f);
+    return gradient / length;
+}
@@ -0,0 +1,112 @@
+#include "DrawQueue.h"
+#include "SpriteBatch.h"
+#include <algorithm>
+#include <cmath>
+
+uint64_t DrawQueue::MakeKey(uint8_t layer, uint32_t depth, uint32_t texture)
+{
+    return (static_cast<uint64_t>(layer) << 56) |
+           (static_cast<uint64_t>(depth) << 24) |
+           static_cast<uint64_t>(texture & MAX_TEXTURE_ID);
+}
+
+uint32_t DrawQueue::DepthFromY(float y)
+{
+    // Por encima del borde superior del mundo todo comparte profundidad 0
+    if (!(y > 0.0f))
+        return 0;
+    // En double: un float no representa MAX_DEPTH exacto
+    double quarters = std::floor(static_cast<double>(y) * 4.0);
+    return quarters >= static_cast<double>(MAX_DEPTH) ? MAX_DEPTH : static_cast<uint32_t>(quarters);
+}
+
+void DrawQueue::Clear()
+{
+    m_Quads.clear();
+    m_Commands.clear();
+    m_Textures.clear();
+}
+
+uint32_t DrawQueue::TextureId(SDL_Texture *texture)
+{
+    if (!texture)
+        return 0;
+
+    // Pocas texturas por frame (con atlas, 1-3): búsqueda lineal
+    auto it = std::find(m_Textures.begin(), m_Textures.end(), texture);
+    if (it != m_Textures.end())
+        return static_cast<uint32_t>(std::min<size_t>(it - m_Textures.begin() + 1, MAX_TEXTURE_ID));
+
+    m_Textures.push_back(texture);
+    return static_cast<uint32_t>(std::min<size_t>(m_Textures.size(), MAX_TEXTURE_ID));
+}
+
+void DrawQueue::PushCommand(uint8_t layer, uint32_t depth, SDL_Texture *texture)
+{
+    // Se añaden en orden de emisión: Sort (estable) lo conserva a igual clave
+    m_Commands.push_back(Command{MakeKey(layer, depth, TextureId(texture)),
+                                 static_cast<uint32_t>(m_Quads.size() - 1)});
+}
+
+void DrawQueue::PushSprite(uint8_t layer, uint32_t depth, SDL_Texture *texture, const SDL_FRect *source,
+                           const SDL_FRect &dst)
+{
+    if (!texture)
+        return;
+
+    m_Quads.push_back(Quad{texture, source ? *source : SDL_FRect{}, dst, SDL_FColor{1.0f, 1.0f, 1.0f, 1.0f},
+                           source != nullptr});
+    PushCommand(layer, depth, texture);
+}
+
+void DrawQueue::PushRect(uint8_t layer, uint32_t depth, const SDL_FRect &dst, SDL_FColor color)
+{
+    m_Quads.push_back(Quad{nullptr, SDL_FRect{}, dst, color, false});
+    PushCommand(layer, depth, nullptr);
+}
+
+void DrawQueue::Sort()
+{
+    const size_t count = m_Commands.size();
+    if (count < 2)
+        return;
+
+    m_Scratch.resize(count);
+
+    // Radix sort LSD estable: 8 pasadas de 1 byte, de menos a más significativo
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        size_t histogram[256] = {};
+        for (const Command &command : m_Commands)
+            ++histogram[(command.key >> shift) & 0xFF];
+
+        // Todos los comandos comparten este byte: la pasada no cambiaría nada
+        if (histogram[(m_Commands[0].key >> shift) & 0xFF] == count)
+            continue;
+
+        size_t offset = 0;
+        for (size_t &bucket : histogram)
+        {
+            size_t bucketCount = bucket;
+            bucket = offset;
+            offset += bucketCount;
+        }
+
+        for (const Command &command : m_Commands)
+            m_Scratch[histogram[(command.key >> shift) & 0xFF]++] = command;
+
+        m_Commands.swap(m_Scratch);
+    }
+}
+
+void DrawQueue::Submit(SpriteBatch &batch) const
+{
+    for (const Command &command : m_Commands)
+    {
+        const Quad &quad = m_Quads[command.quad];
+        if (quad.texture)
+            batch.AddSprite(quad.texture, quad.hasSource ? &quad.source : nullptr, quad.dst);
+        else
+            batch.AddRect(quad.dst, quad.color);
+    }
+}
@@ -5,17 +5,44 @@
 #include "../include/Components/TransformComponent.h"
 #include "../include/Components/SpriteComponent.h"
 #include "../include/Components/ColliderComponent.h"
+#include "../include/Components/PlayerComponent.h"
+#include "../include/Components/HealthComponent.h"
 #include <spdlog/spdlog.h>
 #include <glm/glm.hpp>
 #include <random>
 
 // ========================================
-// RNG SINGLETON
+// CREAR JUGADOR
 // ========================================
-std::mt19937 &EntityManager::GetRng()
+Entity &EntityManager::CreatePlayer(
+    World &world,
+    AssetLoader &assets,
+    const ConfigLoader::PlayerEntityConfig &config)
 {
-    static std::mt19937 rng(std::random_device{}());
-    return rng;
+    // PASO 1: Crear entidad
+    Entity &player = world.createEntity();
+
+    // PASO 2: Agregar PlayerComponent
+    auto playerComp = std::make_unique<PlayerComponent>();
+    player.AddComponent(std::move(playerComp));
+
+    // PASO 3: Agregar TransformComponent (posición precalculada del config)
+    auto transform = std::make_unique<TransformComponent>(config.spawnX, config.spawnY, 0.0f, 0.0f);
+    player.AddComponent(std::move(transform));
+
+    // PASO 4: Agregar SpriteComponent
+    auto sprite = std::make_unique<SpriteComponent>(config.spritePath, assets);
+    player.AddComponent(std::move(sprite));
+
+    // PASO 5: Agregar ColliderComponent
+    auto collider = std::make_unique<ColliderComponent>(config.colliderWidth, config.colliderHeight);
+    player.AddComponent(std::move(collider));
+
+    // PASO 6: Agregar HealthComponent
+    auto health = std::make_unique<HealthComponent>(config.maxHp);
+    player.AddComponent(std::move(health));
+
+    return player;
 }
 
 // ========================================
@@ -23,9 +50,11 @@ std::mt19937 &EntityManager::GetRng()
 // ========================================
 void EntityManager::CreateEnemy(
     World &world,
-    SDL_Renderer *renderer,
+    AssetLoader &assets,
     const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes,
     const std::string &enemyTypeName,
+    float worldWidth,
+    float worldHeight,
     float speedMultiplier)
 {
     // PASO 1: Buscar el tipo de enemigo por nombre
@@ -53,11 +82,12 @@ void EntityManager::CreateEnemy(
     auto enemyComp = std::make_unique<EnemyComponent>(
         adjustedSpeed,
         enemyType->focusRange,
-        enemyType->velocitySmoothing);
+        enemyType->velocitySmoothing,
+        enemyType->initialBehaviorState);
     enemy.AddComponent(std::move(enemyComp));
 
     // PASO 4: Agregar SpriteComponent
-    auto sprite = std::make_unique<SpriteComponent>(enemyType->spritePath, renderer);
+    auto sprite = std::make_unique<SpriteComponent>(enemyType->spritePath, assets);
     enemy.AddComponent(std::move(sprite));
 
     // PASO 5: Agregar ColliderComponent
@@ -66,10 +96,10 @@ void EntityManager::CreateEnemy(
         enemyType->colliderHeight);
     enemy.AddComponent(std::move(collider));
 
-    // PASO 6: Generar posición aleatoria
-    std::mt19937 &rng = GetRng();
-    std::uniform_real_distribution<float> posXDist(0.0f, std::max(0.0f, 1280.0f - enemyType->colliderWidth));
-    std::uniform_real_distribution<float> posYDist(0.0f, std::max(0.0f, 720.0f - enemyType->colliderHeight));
+    // PASO 6: Generar posición aleatoria (en todo el mundo, no solo en la vista)
+    std::mt19937 &rng = world.GetRng();
+    std::uniform_real_distribution<float> posXDist(0.0f, std::max(0.0f, worldWidth - enemyType->colliderWidth));
+    std::uniform_real_distribution<float> posYDist(0.0f, std::max(0.0f, worldHeight - enemyType->colliderHeight));
     std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * 3.14159265f);
 
     float px = posXDist(rng);
@@ -83,6 +113,10 @@ void EntityManager::CreateEnemy(
     // PASO 8: Agregar TransformComponent
     auto transform = std::make_unique<TransformComponent>(px, py, vx, vy);
     enemy.AddComponent(std::move(transform));
+
+    // PASO 9: Despawn programado (lifetime <= 0 = vive hasta el final de la ola)
+    if (enemyType->lifetime > 0.0f)
+        world.ScheduleTimer(enemyType->lifetime, enemy.m_Id, TimerTag::ENEMY_LIFETIME);
 }
 
 // ========================================
@@ -90,7 +124,7 @@ void EntityManager::CreateEnemy(
 // ========================================
 void EntityManager::CreateObstacle(
     World &world,
-    SDL_Renderer *renderer,
+    AssetLoader &assets,
     const ConfigLoader::ObstacleConfig &config,
     float x,
     float y)
@@ -102,8 +136,9 @@ void EntityManager::CreateObstacle(
     auto obstacleComp = std::make_unique<ObstacleComponent>(true);
     obstacle.AddComponent(std::move(obstacleComp));
 
-    // PASO 3: Agregar SpriteComponent
-    auto sprite = std::make_unique<SpriteComponent>(config.spritePath, renderer);
+    // PASO 3: Agregar SpriteComponent (bajo las entidades: se dibuja en la capa estática cacheada)
+    auto sprite = std::make_unique<SpriteComponent>(config.spritePath, assets);
+    sprite->m_Layer = RenderLayer::GROUND;
     obstacle.AddComponent(std::move(sprite));
 
     // PASO 4: Agregar ColliderComponent
@@ -79,4 +79,15 @@ ObstacleSpawnEvent::ObstacleSpawnEvent(float posX, float posY)
 std::string ObstacleSpawnEvent::getType() const
 {
     return "ObstacleSpawnEvent";
-}
\ No newline at end of file
+}
+
+// TimerEvent implementation
+TimerEvent::TimerEvent(uint32_t id, TimerTag timerTag)
+    : entityId(id), tag(timerTag)
+{
+}
+
+std::string TimerEvent::getType() const
+{
+    return "TimerEvent";
+}
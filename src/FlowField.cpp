@@ -0,0 +1,200 @@
+#include "FlowField.h"
+#include "Entity.h"
+#include "Components/TransformComponent.h"
+#include "Components/ColliderComponent.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+namespace
+{
+    constexpr uint32_t UNREACHABLE = std::numeric_limits<uint32_t>::max();
+    constexpr uint32_t STRAIGHT_COST = 10; // Coste ortogonal
+    constexpr uint32_t DIAGONAL_COST = 14; // ~10 * sqrt(2)
+
+    // Vecinos 8-conectados: primero los 4 ortogonales, luego las diagonales
+    constexpr int NEIGHBOR_DX[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+    constexpr int NEIGHBOR_DY[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+}
+
+FlowField::FlowField(float worldWidth, float worldHeight, float cellSize)
+    : m_CellSize(std::max(1.0f, cellSize)),
+      m_Cols(std::max(1, static_cast<int>(std::ceil(worldWidth / std::max(1.0f, cellSize))))),
+      m_Rows(std::max(1, static_cast<int>(std::ceil(worldHeight / std::max(1.0f, cellSize))))),
+      m_TargetCell(-1),
+      m_Dirty(true)
+{
+    const size_t cellCount = static_cast<size_t>(m_Cols) * m_Rows;
+    m_Blocked.assign(cellCount, 0);
+    m_Cost.assign(cellCount, UNREACHABLE);
+    m_Directions.assign(cellCount, glm::vec2(0.0f));
+}
+
+int FlowField::CellIndex(const glm::vec2 &position) const
+{
+    int col = static_cast<int>(std::floor(position.x / m_CellSize));
+    int row = static_cast<int>(std::floor(position.y / m_CellSize));
+    if (col < 0 || row < 0 || col >= m_Cols || row >= m_Rows)
+        return -1;
+    return row * m_Cols + col;
+}
+
+void FlowField::SetObstacles(const std::vector<Entity *> &obstacles, float clearance)
+{
+    std::fill(m_Blocked.begin(), m_Blocked.end(), 0);
+
+    for (Entity *obstacle : obstacles)
+    {
+        auto *transform = obstacle->GetComponent<TransformComponent>();
+        auto *collider = obstacle->GetComponent<ColliderComponent>();
+        if (!transform || !collider)
+            continue;
+
+        // AABB inflado por el margen (pivote en esquina superior izquierda)
+        const float left = transform->m_Position.x - clearance;
+        const float top = transform->m_Position.y - clearance;
+        const float right = transform->m_Position.x + collider->m_Bounds.x + clearance;
+        const float bottom = transform->m_Position.y + collider->m_Bounds.y + clearance;
+
+        // Bloquear celdas cuyo centro cae dentro del AABB inflado
+        const int colMin = std::max(0, static_cast<int>(std::floor(left / m_CellSize)));
+        const int colMax = std::min(m_Cols - 1, static_cast<int>(std::floor(right / m_CellSize)));
+        const int rowMin = std::max(0, static_cast<int>(std::floor(top / m_CellSize)));
+        const int rowMax = std::min(m_Rows - 1, static_cast<int>(std::floor(bottom / m_CellSize)));
+
+        for (int row = rowMin; row <= rowMax; ++row)
+        {
+            const float centerY = (row + 0.5f) * m_CellSize;
+            if (centerY < top || centerY > bottom)
+                continue;
+
+            for (int col = colMin; col <= colMax; ++col)
+            {
+                const float centerX = (col + 0.5f) * m_CellSize;
+                if (centerX >= left && centerX <= right)
+                    m_Blocked[row * m_Cols + col] = 1;
+            }
+        }
+    }
+
+    m_Dirty = true;
+}
+
+bool FlowField::Update(const glm::vec2 &target)
+{
+    const int targetCell = CellIndex(target);
+    if (targetCell < 0)
+        return false; // Objetivo fuera del mundo: conservar último campo
+
+    if (!m_Dirty && targetCell == m_TargetCell)
+        return false;
+
+    Compute(targetCell);
+    m_TargetCell = targetCell;
+    m_Dirty = false;
+    return true;
+}
+
+void FlowField::Compute(int targetCell)
+{
+    std::fill(m_Cost.begin(), m_Cost.end(), UNREACHABLE);
+
+    // ========================================
+    // PASO 1: Campo de integración (Dijkstra)
+    // ========================================
+    using Node = std::pair<uint32_t, int>; // (coste, celda)
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+
+    m_Cost[targetCell] = 0;
+    open.push({0, targetCell});
+
+    while (!open.empty())
+    {
+        const Node current = open.top();
+        open.pop();
+
+        const uint32_t cost = current.first;
+        const int cell = current.second;
+        if (cost > m_Cost[cell])
+            continue; // Entrada obsoleta
+
+        const int col = cell % m_Cols;
+        const int row = cell / m_Cols;
+
+        for (int n = 0; n < 8; ++n)
+        {
+            const int nCol = col + NEIGHBOR_DX[n];
+            const int nRow = row + NEIGHBOR_DY[n];
+            if (nCol < 0 || nRow < 0 || nCol >= m_Cols || nRow >= m_Rows)
+                continue;
+
+            const int neighbor = nRow * m_Cols + nCol;
+            if (m_Blocked[neighbor])
+                continue;
+
+            // Diagonales: no cortar esquinas de obstáculos
+            const bool diagonal = n >= 4;
+            if (diagonal && (m_Blocked[row * m_Cols + nCol] || m_Blocked[nRow * m_Cols + col]))
+                continue;
+
+            const uint32_t newCost = cost + (diagonal ? DIAGONAL_COST : STRAIGHT_COST);
+            if (newCost < m_Cost[neighbor])
+            {
+                m_Cost[neighbor] = newCost;
+                open.push({newCost, neighbor});
+            }
+        }
+    }
+
+    // ========================================
+    // PASO 2: Dirección hacia el vecino de menor coste
+    // ========================================
+    // Las celdas bloqueadas también reciben dirección (hacia el vecino libre más barato)
+    // para que un enemigo solapado con un obstáculo salga por el lado correcto.
+    for (int row = 0; row < m_Rows; ++row)
+    {
+        for (int col = 0; col < m_Cols; ++col)
+        {
+            const int cell = row * m_Cols + col;
+            m_Directions[cell] = glm::vec2(0.0f);
+
+            if (cell == targetCell)
+                continue;
+
+            uint32_t bestCost = m_Blocked[cell] ? UNREACHABLE : m_Cost[cell];
+            int bestN = -1;
+
+            for (int n = 0; n < 8; ++n)
+            {
+                const int nCol = col + NEIGHBOR_DX[n];
+                const int nRow = row + NEIGHBOR_DY[n];
+                if (nCol < 0 || nRow < 0 || nCol >= m_Cols || nRow >= m_Rows)
+                    continue;
+
+                const bool diagonal = n >= 4;
+                if (diagonal && (m_Blocked[row * m_Cols + nCol] || m_Blocked[nRow * m_Cols + col]))
+                    continue;
+
+                const uint32_t neighborCost = m_Cost[nRow * m_Cols + nCol];
+                if (neighborCost < bestCost)
+                {
+                    bestCost = neighborCost;
+                    bestN = n;
+                }
+            }
+
+            if (bestN >= 0)
+                m_Directions[cell] = glm::normalize(glm::vec2(NEIGHBOR_DX[bestN], NEIGHBOR_DY[bestN]));
+        }
+    }
+}
+
+glm::vec2 FlowField::Sample(const glm::vec2 &position) const
+{
+    const int cell = CellIndex(position);
+    if (cell < 0)
+        return glm::vec2(0.0f);
+    return m_Directions[cell];
+}
@@ -1,95 +1,160 @@
 #include "Game.h"
 #include "ConfigLoader.h"
 #include "Entity.h"
+#include "EntityManager.h"
 #include "Components/TransformComponent.h"
 #include "Components/SpriteComponent.h"
 #include "Components/ColliderComponent.h"
 #include "Components/PlayerComponent.h"
 #include "Components/HealthComponent.h"
 #include "Components/EnemyComponent.h"
+#include "Components/CameraComponent.h"
 #include <glm/glm.hpp>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace
+{
+    // dt variable: paso mínimo entre actualizaciones (el present ya no marca el ritmo)
+    constexpr Uint64 MIN_VARIABLE_STEP_NS = 4000000; // 4 ms: como mucho ~250 actualizaciones/s
+}
 
 Game::Game()
-    : m_Window(nullptr), m_Renderer(nullptr), m_IsRunning(false), m_GameOver(false), m_GameOverPrinted(false), m_World()
+    : m_Window(nullptr), m_Renderer(nullptr), m_Ancho(0.0f), m_Alto(0.0f), m_WorldWidth(0.0f), m_WorldHeight(0.0f),
+      m_IsRunning(false), m_GameOver(false), m_GameOverPrinted(false), m_World(),
+      m_FixedTimestep(true), m_FixedDeltaTime(1.0f / 60.0f), m_MaxCatchUpSteps(5), m_Accumulator(0.0),
+      m_InputClockNs(0), m_StartupNs(0), m_StartupPhaseNs(0), m_RenderStatsIntervalNs(0), m_RenderStatsStartNs(0),
+      m_RenderStatsFrames(0), m_RenderStatsCalls(0), m_RenderStatsQuads(0)
 {
 }
 
 bool Game::Initialize()
 {
+    m_StartupNs = SDL_GetTicksNS();
+    m_StartupPhaseNs = m_StartupNs;
+
     // ========================================
-    // CARGAR CONFIGURACIÓN DESDE JSON
+    // FASE 1: settings.json (tamaño de ventana e hilos: lo necesita todo lo demás)
     // ========================================
     ConfigLoader config;
     if (!config.LoadSettings())
         return false;
 
-    if (!config.LoadEnemyConfig())
-        return false;
-
-    // Cargar configuración de oleadas
-    if (!config.LoadWavesConfig())
-    {
-        spdlog::error("No se pudo cargar la configuración de oleadas");
-        return false;
-    }
-
-    // Cargar configuración de obstáculos (unidad mínima + posiciones por fase)
-    config.LoadObstacleConfig();
-    config.LoadObstaclesByPhaseConfig();
-
     auto window = config.GetWindow();
     auto gameplay = config.GetGameplay();
     auto collision = config.GetCollision();
-    const auto &enemyTypes = config.GetEnemyEntity().enemyTypes; // Vector de structs tipadas
 
     m_Ancho = window.width;
     m_Alto = window.height;
+    m_WorldWidth = config.GetWorld().width;
+    m_WorldHeight = config.GetWorld().height;
+
+    m_FixedTimestep = gameplay.fixedTimestep;
+    m_FixedDeltaTime = 1.0f / static_cast<float>(std::max(1, gameplay.tickRate));
+    m_MaxCatchUpSteps = std::max(1, gameplay.maxCatchUpSteps);
+    m_World.SetTimerResolution(m_FixedDeltaTime);
+
+    // Pool de hilos: -1 = un trabajador por núcleo menos el principal (render) y el de simulación
+    const auto &threading = config.GetThreading();
+    size_t workerCount = threading.workerThreads >= 0
+                             ? static_cast<size_t>(threading.workerThreads)
+                             : static_cast<size_t>(std::max(2u, std::thread::hardware_concurrency()) - 2);
+    m_JobSystem = std::make_unique<JobSystem>(workerCount);
+    spdlog::info("JobSystem: {} hilos trabajadores", m_JobSystem->GetWorkerCount());
+
+    // Texturas: se decodifican desde ya; la subida espera al renderer (AttachRenderer)
+    const auto &assets = config.GetAssets();
+    m_Assets = std::make_unique<AssetLoader>(static_cast<size_t>(std::max(1, assets.decodeThreads)),
+                                             assets.maxUploadsPerFrame);
+    m_Assets->SetUnusedGrace(assets.unusedTextureGrace);
+    m_Assets->ConfigureAtlas(assets.atlasPageSize);
+    m_MusicSystem = std::make_unique<MusicSystem>();
+    MarkStartupPhase("settings.json + hilos");
 
     // ========================================
-    // INICIALIZAR SDL
+    // FASE 2 (segundo plano): JSON restantes → sprites iniciales; WAV de la música
     // ========================================
-    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO))
-    {
-        spdlog::error("SDL_Init error: {}", SDL_GetError());
-        return false;
-    }
+    JobCounter background;
+    bool configsOk = false;
+    bool musicOk = false;
+    double configsMs = 0.0;
+    double musicMs = 0.0;
+
+    m_JobSystem->Submit([this, &config, &configsOk, &configsMs]()
+                        {
+                            Uint64 start = SDL_GetTicksNS();
+                            configsOk = config.LoadGameConfigs(m_JobSystem.get());
+                            if (configsOk)
+                                PreloadTextures(config);
+                            configsMs = (SDL_GetTicksNS() - start) / 1e6; },
+                        background);
+
+    m_JobSystem->Submit([this, &musicOk, &musicMs]()
+                        {
+                            Uint64 start = SDL_GetTicksNS();
+                            musicOk = m_MusicSystem->DecodeMusic("assets/song/Behind-The-Scene.wav");
+                            musicMs = (SDL_GetTicksNS() - start) / 1e6; },
+                        background);
 
-    m_Window = SDL_CreateWindow(window.title.c_str(), static_cast<int>(m_Ancho), static_cast<int>(m_Alto), SDL_WINDOW_BORDERLESS);
-    if (!m_Window)
-    {
-        spdlog::error("SDL_CreateWindow error: {}", SDL_GetError());
-        return false;
-    }
+    // ========================================
+    // FASE 2 (hilo principal): INICIALIZAR SDL, VENTANA Y RENDERER
+    // ========================================
+    // Con 0 trabajadores Submit ya ejecutó todo lo anterior aquí mismo (arranque en serie)
+    bool sdlOk = InitializeSDL(window);
+    MarkStartupPhase("SDL + ventana + renderer");
 
-    m_Renderer = SDL_CreateRenderer(m_Window, nullptr);
-    if (!m_Renderer)
-    {
-        spdlog::error("SDL_CreateRenderer error: {}", SDL_GetError());
-        SDL_DestroyWindow(m_Window);
-        m_Window = nullptr;
+    // Los trabajos usan variables locales: esperar siempre, incluso si SDL falló
+    m_JobSystem->Wait(background);
+    m_StartupPhases.emplace_back("  configs JSON + peticiones de sprites (paralelo)", configsMs);
+    m_StartupPhases.emplace_back("  decodificación de la música (paralelo)", musicMs);
+    MarkStartupPhase("espera al segundo plano");
+
+    if (!sdlOk || !configsOk)
         return false;
-    }
+
+    m_Assets->AttachRenderer(m_Renderer);
+
+    const auto &render = config.GetRender();
+    m_Batch = std::make_unique<SpriteBatch>(m_Renderer);
+    m_Batch->SetEnabled(render.batching);
+    m_RenderStatsIntervalNs = render.statsInterval > 0.0f ? static_cast<Uint64>(render.statsInterval * 1e9) : 0;
 
     // ========================================
-    // INICIALIZAR SISTEMAS ECS
+    // FASE 3: INICIALIZAR SISTEMAS ECS
     // ========================================
-    GameContext ctx(m_Renderer, m_Ancho, m_Alto); // solucion de long parameter list
+    const auto &enemyTypes = config.GetEnemyEntity().enemyTypes; // Vector de structs tipadas
+
+    // ✅ Calcular posición de spawn del jugador basada en dimensiones del mundo (lo usa Start)
+    config.CalculatePlayerSpawnPosition(m_WorldWidth, m_WorldHeight);
+    m_PlayerConfig = config.GetPlayerEntity();
+
+    GameContext ctx(m_Renderer, m_WorldWidth, m_WorldHeight, m_JobSystem.get(), m_Assets.get(), m_Batch.get()); // solucion de long parameter list
+    ctx.viewWidth = m_Ancho; // La cámara del jugador muestra una ventana del mundo
+    ctx.viewHeight = m_Alto;
 
     m_PlayerInputSystem = std::make_unique<PlayerInputSystem>(ctx, gameplay.playerSpeed);
 
-    m_MovementSystem = std::make_unique<MovementSystem>();
+    m_MovementSystem = std::make_unique<MovementSystem>(ctx);
 
     m_CollisionSystem = std::make_unique<CollisionSystem>(ctx);
 
     m_CollisionResponseSystem = std::make_unique<CollisionResponseSystem>(ctx, collision.playerPushStrength, collision.enemyPushStrength);
 
     m_RenderSystem = std::make_unique<RenderSystem>(ctx);
+    m_RenderSystem->SetLayerCaching(render.cacheLayers);
 
     m_DamageSystem = std::make_unique<DamageSystem>(&m_IsRunning, &m_GameOver, collision.playerInvulnerabilityDuration);
 
-    m_EnemyAISystem = std::make_unique<EnemyAISystem>();
+    m_EnemyAISystem = std::make_unique<EnemyAISystem>(ctx, config.GetAI(), config.GetEnemyEntity().behaviors);
+    m_EnemyAISystem->SeedRng(m_World);
 
     m_HUDSystem = std::make_unique<HUDSystem>(ctx);
+    m_HUDSystem->SetLayerCaching(render.cacheLayers);
+
+    m_ProjectileSystem = std::make_unique<ProjectileSystem>(ctx, config.GetProjectiles());
+
+    m_Snapshots = std::make_unique<RenderSnapshotBuffer>();
 
     // ✅ WaveManagerSystem: Orquesta WaveSystem, SpawnSystem, LifetimeSystem
     m_WaveManagerSystem = std::make_unique<WaveManagerSystem>(ctx, enemyTypes);
@@ -100,61 +165,132 @@ bool Game::Initialize()
     // Cargar configuración de obstáculos
     m_WaveManagerSystem->LoadObstacleConfig(config.GetObstacle());
     m_WaveManagerSystem->LoadObstaclesByPhase(config.GetObstaclesByPhase());
+    m_WaveManagerSystem->SetPrefetchLeadTime(assets.prefetchLeadTime);
 
     m_WaveManagerSystem->StartWaves(m_World);
 
     // ========================================
-    // INICIALIZAR SISTEMA DE MÚSICA
+    // PIPELINE Y PLANIFICADOR: el orden serie sale de la lista de tipos
     // ========================================
-    m_MusicSystem = std::make_unique<MusicSystem>();
-    if (!m_MusicSystem->LoadMusic("assets/song/Behind-The-Scene.wav"))
+    // Update() usa el pipeline cuando el planificador sería serie
+    m_Pipeline = std::make_unique<SimulationPipeline>(
+        SIMULATION_STAGE_NAMES,
+        *m_WaveManagerSystem, *m_PlayerInputSystem, *m_EnemyAISystem, *m_MovementSystem,
+        *m_ProjectileSystem, *m_CollisionSystem, *m_CollisionResponseSystem, *m_DamageSystem);
+
+    m_Scheduler = std::make_unique<SystemScheduler>(*m_JobSystem);
+    m_Scheduler->SetForceSerial(threading.forceSerial);
+    m_Pipeline->ForEach([this](auto &system, const char *name)
+                        { m_Scheduler->Add(system, name); });
+    m_Scheduler->LogGraph();
+
+    // ========================================
+    // INICIALIZAR SISTEMA DE MÚSICA (WAV ya decodificado en segundo plano)
+    // ========================================
+    if (!musicOk || !m_MusicSystem->OpenStream())
     {
         spdlog::warn("No se pudo cargar la música (continuando sin audio)");
         // No es crítico - el juego puede continuar sin música
     }
 
     spdlog::info("Sistemas ECS inicializados correctamente");
+    MarkStartupPhase("sistemas ECS + audio");
     m_IsRunning = true;
     return true;
 }
 
-bool Game::Start()
+bool Game::InitializeSDL(const ConfigLoader::WindowConfig &window)
 {
-    // ========================================
-    // CARGAR CONFIGURACIÓN DEL JUGADOR
-    // ========================================
-    ConfigLoader config;
-    if (!config.LoadPlayerConfig())
+    if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO))
+    {
+        spdlog::error("SDL_Init error: {}", SDL_GetError());
         return false;
+    }
 
-    // ✅ Calcular posición de spawn basada en dimensiones del mundo
-    config.CalculatePlayerSpawnPosition(m_Ancho, m_Alto);
-    auto playerCfg = config.GetPlayerEntity();
+    m_Window = SDL_CreateWindow(window.title.c_str(), static_cast<int>(m_Ancho), static_cast<int>(m_Alto), SDL_WINDOW_BORDERLESS);
+    if (!m_Window)
+    {
+        spdlog::error("SDL_CreateWindow error: {}", SDL_GetError());
+        return false;
+    }
 
-    // ========================================
-    // CREAR EL JUGADOR
-    // ========================================
-    Entity &player = m_World.createEntity();
+    m_Renderer = SDL_CreateRenderer(m_Window, nullptr);
+    if (!m_Renderer)
+    {
+        spdlog::error("SDL_CreateRenderer error: {}", SDL_GetError());
+        SDL_DestroyWindow(m_Window);
+        m_Window = nullptr;
+        return false;
+    }
+
+    return true;
+}
+
+void Game::PreloadTextures(const ConfigLoader &config)
+{
+    // Solo peticiones: la decodificación corre en los hilos del AssetLoader.
+    // Lo que se pida después con la misma ruta reutiliza el mismo handle.
+    // Todos los sprites de los JSON van al atlas (se empaqueta en Start → WaitForAll)
+    m_Assets->RequestAtlasSprite(config.GetPlayerEntity().spritePath);
+
+    for (const auto &enemyType : config.GetEnemyEntity().enemyTypes)
+        m_Assets->RequestAtlasSprite(enemyType.spritePath);
 
-    auto playerComp = std::make_unique<PlayerComponent>();
-    player.AddComponent(std::move(playerComp));
+    if (!config.GetObstaclesByPhase().phases.empty())
+        m_Assets->RequestAtlasSprite(config.GetObstacle().spritePath);
 
-    //  Usar posición precalculada del config
-    auto playerTransform = std::make_unique<TransformComponent>(playerCfg.spawnX, playerCfg.spawnY, 0.0f, 0.0f);
-    player.AddComponent(std::move(playerTransform));
+    const auto &waves = config.GetWaves().waves;
+    if (!waves.empty())
+        m_Assets->RequestTexture(waves.front().imagePath);
+}
 
-    auto playerSprite = std::make_unique<SpriteComponent>(playerCfg.spritePath, m_Renderer);
-    player.AddComponent(std::move(playerSprite));
+void Game::MarkStartupPhase(const char *name)
+{
+    Uint64 now = SDL_GetTicksNS();
+    m_StartupPhases.emplace_back(name, (now - m_StartupPhaseNs) / 1e6);
+    m_StartupPhaseNs = now;
+}
 
-    auto playerCollider = std::make_unique<ColliderComponent>(playerCfg.colliderWidth, playerCfg.colliderHeight);
-    player.AddComponent(std::move(playerCollider));
+void Game::LogStartupReport() const
+{
+    // Objetivo de tiempo hasta el primer frame
+    constexpr double TARGET_MS = 200.0;
 
-    auto playerHealth = std::make_unique<HealthComponent>(playerCfg.maxHp);
-    player.AddComponent(std::move(playerHealth));
+    spdlog::info("=== ARRANQUE ===");
+    for (const auto &[name, ms] : m_StartupPhases)
+        spdlog::info("{:<52} {:7.1f} ms", name, ms);
+
+    double totalMs = (SDL_GetTicksNS() - m_StartupNs) / 1e6;
+    if (totalMs <= TARGET_MS)
+        spdlog::info("Primer frame a los {:.1f} ms (objetivo < {:.0f} ms)", totalMs, TARGET_MS);
+    else
+        spdlog::warn("Primer frame a los {:.1f} ms (objetivo < {:.0f} ms)", totalMs, TARGET_MS);
+}
+
+bool Game::Start()
+{
+    // ========================================
+    // CREAR EL JUGADOR
+    // ========================================
+    //  Usar posición precalculada en Initialize
+    const auto &playerCfg = m_PlayerConfig;
+    Entity &player = EntityManager::CreatePlayer(m_World, *m_Assets, playerCfg);
+
+    // Cámara: sigue al jugador con el tamaño de la ventana (RenderSystem la actualiza al capturar)
+    player.AddComponent(std::make_unique<CameraComponent>(m_Ancho, m_Alto));
 
     spdlog::info("Jugador creado: ID={}, Posicion=({:.1f},{:.1f}), HP={}",
                  player.m_Id, playerCfg.spawnX, playerCfg.spawnY, playerCfg.maxHp);
 
+    // ========================================
+    // PANTALLA DE CARGA: jugador y texturas de la primera oleada
+    // ========================================
+    // Los fondos de las oleadas siguientes se precargan en segundo plano (WaveSystem::PrefetchWave)
+    Uint64 loadStart = SDL_GetTicksNS();
+    m_Assets->WaitForAll();
+    spdlog::info("Texturas iniciales listas en {:.1f} ms", (SDL_GetTicksNS() - loadStart) / 1e6);
+    MarkStartupPhase("jugador + texturas iniciales");
+
     // ========================================
     // INICIAR MÚSICA
     // ========================================
@@ -176,9 +312,22 @@ void Game::ProcessInput()
         case SDL_EVENT_QUIT:
             m_IsRunning = false;
             break;
+        case SDL_EVENT_RENDER_TARGETS_RESET:
+        case SDL_EVENT_RENDER_DEVICE_RESET:
+            // El contenido de los render targets se perdió: regenerar las capas cacheadas
+            m_RenderSystem->InvalidateCaches();
+            m_HUDSystem->InvalidateCaches();
+            break;
+        case SDL_EVENT_KEY_UP:
+            m_Input.Push({event.key.timestamp, event.key.scancode, false});
+            break;
         case SDL_EVENT_KEY_DOWN:
             if (!event.key.repeat)
             {
+                // Timestamp de SDL: el tick se elige por cuándo se pulsó, no por cuándo se leyó
+                if (!m_Input.Push({event.key.timestamp, event.key.scancode, true}))
+                    spdlog::warn("InputQueue llena: se descarta una pulsación");
+
                 // Si está en Game Over, Enter o ESC salen
                 if (m_GameOver)
                 {
@@ -201,6 +350,14 @@ void Game::ProcessInput()
     }
 }
 
+void Game::ApplyInput(Uint64 untilNs)
+{
+    m_TickInput.clear();
+    m_Input.PopUntil(untilNs, m_TickInput);
+    m_World.BeginInputTick(m_InputClockNs, untilNs, m_TickInput);
+    m_InputClockNs = untilNs;
+}
+
 void Game::Update(float deltaTime)
 {
     // Si está en Game Over, no actualizar la lógica del juego
@@ -208,33 +365,59 @@ void Game::Update(float deltaTime)
         return;
 
     // ========================================
-    // FASE 1: ORQUESTACIÓN (Wave Management)
+    // FASE 0: TEMPORIZADORES (emite TimerEvent vencidos)
     // ========================================
-    // ✅ WaveManagerSystem::update() emite eventos desde WaveSystem
-    m_WaveManagerSystem->update(m_World, deltaTime);
+    m_World.AdvanceTimers(deltaTime);
 
     // ========================================
-    // FASE 2: INPUT & AI
+    // FASES 1-4: Orquestación → Input & AI → Física → Daño
     // ========================================
-    m_PlayerInputSystem->update(m_World, deltaTime);
-    m_EnemyAISystem->update(m_World, deltaTime);
+    // SystemScheduler respeta el orden de registro entre sistemas con
+    // conflicto de datos y solapa el resto en el JobSystem; en serie no hay
+    // nada que solapar y el pipeline estático evita el despacho virtual
+    if (m_Scheduler->IsSerial())
+        m_Pipeline->Run(m_World, deltaTime);
+    else
+        m_Scheduler->Run(m_World, deltaTime);
+}
 
-    // ========================================
-    // FASE 3: FÍSICA (Movement & Collision)
-    // ========================================
-    m_MovementSystem->update(m_World, deltaTime);
-    m_CollisionSystem->update(m_World, deltaTime);
-    m_CollisionResponseSystem->update(m_World, deltaTime);
+void Game::PublishSnapshot(float simulatedTime, float interpolationSpan)
+{
+    RenderSnapshot &snapshot = m_Snapshots->BeginWrite();
+    snapshot.interpolationSpan = interpolationSpan;
+    snapshot.gameOver = m_GameOver;
 
-    // ========================================
-    // FASE 4: DAÑO & LÓGICA DE JUEGO
-    // ========================================
-    m_DamageSystem->update(m_World, deltaTime);
+    // Game Over congela el tiempo final (como antes: ya no se dibujan sprites)
+    if (!snapshot.gameOver)
+    {
+        snapshot.background = m_WaveManagerSystem->GetBackgroundTexture();
+
+        m_RenderSystem->SetSnapshot(&snapshot);
+        m_RenderSystem->update(m_World, simulatedTime);
+        m_RenderSystem->SetSnapshot(nullptr);
+
+        m_ProjectileSystem->Capture(snapshot);
+
+        m_HUDSystem->SetSnapshot(&snapshot);
+        m_HUDSystem->update(m_World, simulatedTime);
+        m_HUDSystem->SetSnapshot(nullptr);
+
+        snapshot.hud.wave = m_WaveManagerSystem->GetCurrentWave() + 1;
+        snapshot.hud.totalWaves = m_WaveManagerSystem->GetTotalWaves();
+    }
+    snapshot.elapsedTime = m_RenderSystem->getElapsedTime();
+
+    m_Snapshots->Publish();
 }
 
-void Game::Render(float deltaTime)
+void Game::Render()
 {
-    if (m_GameOver)
+    // Snapshot publicado más reciente: nunca se lee World desde aquí
+    const RenderSnapshot *snapshot = m_Snapshots->Acquire();
+    if (!snapshot)
+        return;
+
+    if (snapshot->gameOver)
     {
         // Detener música cuando el juego termina (SOLO UNA VEZ)
         if (!m_GameOverPrinted && m_MusicSystem)
@@ -249,7 +432,7 @@ void Game::Render(float deltaTime)
         // Mostrar tiempo final SOLO UNA VEZ
         if (!m_GameOverPrinted)
         {
-            float finalTime = m_RenderSystem->getElapsedTime();
+            float finalTime = snapshot->elapsedTime;
 
             spdlog::info("=== GAME OVER ===");
             spdlog::info("Tiempo Final: {:.2f} segundos", finalTime);
@@ -269,40 +452,163 @@ void Game::Render(float deltaTime)
         SDL_RenderClear(m_Renderer);
 
         // ========================================
-        // FASE 1: RENDERIZAR FONDO (desde WaveSystem)
+        // FASE 1-2: FONDO, SPRITES Y PROYECTILES
         // ========================================
-        m_WaveManagerSystem->render(m_World);
+        // Interpolar según el tiempo transcurrido desde que se publicó el snapshot
+        float alpha = snapshot->InterpolationAt(SDL_GetTicksNS());
+        m_Batch->Begin();
+        m_RenderSystem->Draw(*snapshot, alpha);
 
         // ========================================
-        // FASE 2: RENDERIZAR CAPAS
+        // FASE 3: HUD (interfaz de usuario)
         // ========================================
-        // Capa 2: Sprites de entidades
-        m_RenderSystem->update(m_World, deltaTime);
-
-        // Capa 3: HUD (interfaz de usuario)
-        m_HUDSystem->update(m_World, deltaTime);
+        m_HUDSystem->Draw(*snapshot);
+        m_Batch->End();
+        UpdateRenderStats();
 
         // Presentar frame completo
         SDL_RenderPresent(m_Renderer);
     }
 }
 
+void Game::UpdateRenderStats()
+{
+    if (m_RenderStatsIntervalNs == 0)
+        return;
+
+    Uint64 now = SDL_GetTicksNS();
+    if (m_RenderStatsFrames == 0)
+        m_RenderStatsStartNs = now;
+
+    ++m_RenderStatsFrames;
+    m_RenderStatsCalls += m_Batch->GetDrawCalls();
+    m_RenderStatsQuads += m_Batch->GetQuadCount();
+
+    if (now - m_RenderStatsStartNs < m_RenderStatsIntervalNs)
+        return;
+
+    const double frames = static_cast<double>(m_RenderStatsFrames);
+    // Sin batching cada quad es una llamada: quads/frame es la referencia "antes"
+    spdlog::info("Render: {:.1f} llamadas de dibujo/frame, {:.1f} sin batching ({} frames)",
+                 m_RenderStatsCalls / frames, m_RenderStatsQuads / frames, m_RenderStatsFrames);
+
+    m_RenderStatsFrames = 0;
+    m_RenderStatsCalls = 0;
+    m_RenderStatsQuads = 0;
+}
+
+void Game::SimulationLoop()
+{
+    // Un frame nunca simula más que maxCatchUpSteps ticks (ni en modo dt variable)
+    const double maxFrameTime = static_cast<double>(m_FixedDeltaTime) * m_MaxCatchUpSteps;
+
+    const Uint64 tickNs = static_cast<Uint64>(static_cast<double>(m_FixedDeltaTime) * 1e9);
+
+    Uint64 nanosPreviousFrame = SDL_GetTicksNS();
+    m_InputClockNs = nanosPreviousFrame;
+    while (m_IsRunning)
+    {
+        Uint64 nanosNow = SDL_GetTicksNS();
+        double frameTime = (nanosNow - nanosPreviousFrame) / 1e9;
+        nanosPreviousFrame = nanosNow;
+
+        if (!m_FixedTimestep)
+        {
+            // dt variable (comportamiento clásico), solo limitado contra pausas largas
+            float deltaTime = static_cast<float>(std::min(frameTime, maxFrameTime));
+            ApplyInput(nanosNow);
+            Update(deltaTime);
+            PublishSnapshot(deltaTime, 0.0f);
+
+            // Sin esperar, el hilo giraría con dt≈0 publicando miles de snapshots por segundo
+            Uint64 elapsedNs = SDL_GetTicksNS() - nanosNow;
+            if (elapsedNs < MIN_VARIABLE_STEP_NS)
+                SDL_DelayNS(MIN_VARIABLE_STEP_NS - elapsedNs);
+            continue;
+        }
+
+        // ========================================
+        // PASO FIJO: consumir el acumulador en ticks de m_FixedDeltaTime
+        // ========================================
+        m_Accumulator += frameTime;
+
+        int steps = 0;
+        while (m_Accumulator >= m_FixedDeltaTime && steps < m_MaxCatchUpSteps)
+        {
+            // Cada tick recibe solo las transiciones de su intervalo de tiempo real
+            ApplyInput(m_InputClockNs + tickNs);
+            Update(m_FixedDeltaTime);
+            m_Accumulator -= m_FixedDeltaTime;
+            ++steps;
+        }
+
+        // Demasiado atrasados: descartar el tiempo restante en lugar de acumular deuda
+        if (m_Accumulator >= m_FixedDeltaTime)
+        {
+            m_Accumulator = std::fmod(m_Accumulator, static_cast<double>(m_FixedDeltaTime));
+            // El input descartado se aplica al inicio del siguiente tick (BeginInputTick lo ajusta)
+            m_InputClockNs = nanosNow - static_cast<Uint64>(m_Accumulator * 1e9);
+        }
+
+        if (steps == 0)
+        {
+            // Nada que simular: dormir hasta el próximo tick (el render sigue interpolando)
+            SDL_DelayNS(static_cast<Uint64>((m_FixedDeltaTime - m_Accumulator) * 1e9));
+            continue;
+        }
+
+        PublishSnapshot(m_FixedDeltaTime * steps, m_FixedDeltaTime);
+    }
+}
+
 void Game::Run()
 {
-    auto millisecsPreviousFrame = SDL_GetTicks();
+    // Frame inicial publicado antes de arrancar el hilo (aún no hay concurrencia)
+    PublishSnapshot(0.0f, 0.0f);
+
+    // ========================================
+    // HILO DE SIMULACIÓN: ticks + captura de snapshots
+    // HILO PRINCIPAL: eventos SDL + dibujo del último snapshot
+    // ========================================
+    // SDL exige el renderer en el hilo principal, así que es la simulación la que se muda
+    std::thread simulation(&Game::SimulationLoop, this);
+
+    bool firstFrame = true;
     while (m_IsRunning)
     {
         ProcessInput();
-        double deltaTime = (SDL_GetTicks() - millisecsPreviousFrame) / 1000.0;
+        // Texturas pedidas por la simulación: subir las ya decodificadas (con límite)
+        m_Assets->ProcessUploads();
+        Render();
 
-        Update(deltaTime);
-        millisecsPreviousFrame = SDL_GetTicks();
-        Render(static_cast<float>(deltaTime));
+        if (firstFrame)
+        {
+            MarkStartupPhase("primer frame");
+            LogStartupReport();
+            firstFrame = false;
+        }
     }
+
+    // La simulación nunca espera al hilo principal: basta con unirse
+    simulation.join();
+
+    // Solo con ECS_PIPELINE_TIMING; cada uno registra solo si llegó a ejecutarse
+    // (pipeline en serie, planificador con trabajadores)
+    m_Pipeline->LogTimings();
+    m_Scheduler->LogTimings();
 }
 
 Game::~Game()
 {
+    // Entidades y fondo sueltan sus TextureRef antes de que muera el AssetLoader
+    m_World.Clear();
+    m_WaveManagerSystem.reset();
+
+    // Las texturas pertenecen al AssetLoader y a las capas cacheadas: destruirlas mientras el renderer existe
+    m_RenderSystem.reset();
+    m_HUDSystem.reset();
+    m_Assets.reset();
+
     if (m_Renderer)
     {
         SDL_DestroyRenderer(m_Renderer);
@@ -0,0 +1,33 @@
+#include "InputQueue.h"
+
+bool InputQueue::Push(const InputEvent &event)
+{
+    size_t tail = m_Tail.load(std::memory_order_relaxed);
+    if (tail - m_Head.load(std::memory_order_acquire) >= CAPACITY)
+        return false;
+
+    m_Events[tail & (CAPACITY - 1)] = event;
+    m_Tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+size_t InputQueue::PopUntil(Uint64 untilNs, std::vector<InputEvent> &out)
+{
+    size_t head = m_Head.load(std::memory_order_relaxed);
+    const size_t tail = m_Tail.load(std::memory_order_acquire);
+
+    // SDL entrega los eventos en orden: parar en el primero posterior al tick
+    size_t popped = 0;
+    while (head != tail)
+    {
+        const InputEvent &event = m_Events[head & (CAPACITY - 1)];
+        if (event.timestampNs > untilNs)
+            break;
+        out.push_back(event);
+        ++head;
+        ++popped;
+    }
+
+    m_Head.store(head, std::memory_order_release);
+    return popped;
+}
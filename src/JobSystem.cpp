@@ -0,0 +1,141 @@
+#include "JobSystem.h"
+
+namespace
+{
+    // Cola propia del hilo actual (solo válida para t_Owner)
+    thread_local const JobSystem *t_Owner = nullptr;
+    thread_local size_t t_QueueIndex = 0;
+}
+
+JobSystem::JobSystem(size_t workerCount)
+    : m_QueuedJobs(0), m_Stop(false)
+{
+    // Cola 0: hilo principal (y cualquier hilo externo); 1..N: trabajadores
+    for (size_t i = 0; i < workerCount + 1; ++i)
+        m_Queues.push_back(std::make_unique<WorkQueue>());
+
+    m_Workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+        m_Workers.emplace_back(&JobSystem::WorkerLoop, this, i + 1);
+}
+
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_Stop = true;
+    }
+    m_WakeUp.notify_all();
+
+    for (std::thread &worker : m_Workers)
+        worker.join();
+}
+
+void JobSystem::Submit(Job job, JobCounter &counter)
+{
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    // Modo serie: ejecutar en el acto
+    if (IsSerial())
+    {
+        std::pair<Job, JobCounter *> inlineJob(std::move(job), &counter);
+        Execute(inlineJob);
+        return;
+    }
+
+    const size_t home = (t_Owner == this) ? t_QueueIndex : 0;
+    {
+        std::lock_guard<std::mutex> lock(m_Queues[home]->mutex);
+        m_Queues[home]->jobs.emplace_back(std::move(job), &counter);
+    }
+    m_QueuedJobs.fetch_add(1, std::memory_order_release);
+
+    // Tomar el mutex garantiza que un trabajador a punto de dormir vea el trabajo
+    {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+    }
+    m_WakeUp.notify_one();
+}
+
+bool JobSystem::TryPop(size_t homeQueue, std::pair<Job, JobCounter *> &out)
+{
+    // PASO 1: Cola propia, por el final (lo último encolado, datos aún en caché)
+    {
+        WorkQueue &own = *m_Queues[homeQueue];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.jobs.empty())
+        {
+            out = std::move(own.jobs.back());
+            own.jobs.pop_back();
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // PASO 2: Robar del principio de las colas ajenas (lo más antiguo)
+    for (size_t offset = 1; offset < m_Queues.size(); ++offset)
+    {
+        WorkQueue &victim = *m_Queues[(homeQueue + offset) % m_Queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            out = std::move(victim.jobs.front());
+            victim.jobs.pop_front();
+            m_QueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void JobSystem::Execute(std::pair<Job, JobCounter *> &job)
+{
+    job.first();
+    job.second->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+bool JobSystem::RunPendingJob()
+{
+    if (m_QueuedJobs.load(std::memory_order_acquire) == 0)
+        return false;
+
+    const size_t home = (t_Owner == this) ? t_QueueIndex : 0;
+    std::pair<Job, JobCounter *> job;
+    if (!TryPop(home, job))
+        return false;
+
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Wait(JobCounter &counter)
+{
+    while (counter.pending.load(std::memory_order_acquire) > 0)
+    {
+        if (!RunPendingJob())
+            std::this_thread::yield();
+    }
+}
+
+void JobSystem::WorkerLoop(size_t queueIndex)
+{
+    t_Owner = this;
+    t_QueueIndex = queueIndex;
+
+    while (true)
+    {
+        std::pair<Job, JobCounter *> job;
+        if (TryPop(queueIndex, job))
+        {
+            Execute(job);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_WakeUp.wait(lock, [this]()
+                      { return m_Stop || m_QueuedJobs.load(std::memory_order_acquire) > 0; });
+        if (m_Stop)
+            return;
+    }
+}
@@ -0,0 +1,393 @@
+#include "MatchServer.h"
+#include "EntityManager.h"
+#include "JobSystem.h"
+#include "Components/HealthComponent.h"
+#include "Components/TransformComponent.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <thread>
+
+// ========================================
+// HeadlessMatch
+// ========================================
+HeadlessMatch::HeadlessMatch(const ConfigLoader &config, uint32_t seed)
+    : m_Config(config), m_Seed(seed), m_FixedDeltaTime(1.0f / 60.0f), m_World(),
+      m_Assets(nullptr, 0, 0), m_IsRunning(true), m_GameOver(false)
+{
+    const auto &worldSize = m_Config.GetWorld();
+    const auto &gameplay = m_Config.GetGameplay();
+    const auto &collision = m_Config.GetCollision();
+    const auto &enemyTypes = m_Config.GetEnemyEntity().enemyTypes;
+
+    m_FixedDeltaTime = 1.0f / static_cast<float>(std::max(1, gameplay.tickRate));
+    m_World.SetTimerResolution(m_FixedDeltaTime);
+    m_World.SeedRng(seed);
+
+    // ========================================
+    // SISTEMAS (sin renderer ni pool: todo en el hilo de la partida)
+    // ========================================
+    GameContext ctx(nullptr, worldSize.width, worldSize.height, nullptr, &m_Assets);
+
+    m_PlayerInputSystem = std::make_unique<PlayerInputSystem>(ctx, gameplay.playerSpeed);
+    m_MovementSystem = std::make_unique<MovementSystem>(ctx);
+    m_CollisionSystem = std::make_unique<CollisionSystem>(ctx);
+    m_CollisionResponseSystem = std::make_unique<CollisionResponseSystem>(ctx, collision.playerPushStrength, collision.enemyPushStrength);
+    m_DamageSystem = std::make_unique<DamageSystem>(&m_IsRunning, &m_GameOver, collision.playerInvulnerabilityDuration);
+    m_EnemyAISystem = std::make_unique<EnemyAISystem>(ctx, m_Config.GetAI(), m_Config.GetEnemyEntity().behaviors);
+    m_EnemyAISystem->SeedRng(m_World);
+    m_ProjectileSystem = std::make_unique<ProjectileSystem>(ctx, m_Config.GetProjectiles());
+
+    m_WaveManagerSystem = std::make_unique<WaveManagerSystem>(ctx, enemyTypes);
+    m_WaveManagerSystem->LoadWavesConfig(m_Config.GetWaves().waves);
+    m_WaveManagerSystem->LoadObstacleConfig(m_Config.GetObstacle());
+    m_WaveManagerSystem->LoadObstaclesByPhase(m_Config.GetObstaclesByPhase());
+    m_WaveManagerSystem->StartWaves(m_World);
+
+    m_Pipeline = std::make_unique<SimulationPipeline>(
+        SIMULATION_STAGE_NAMES,
+        *m_WaveManagerSystem, *m_PlayerInputSystem, *m_EnemyAISystem, *m_MovementSystem,
+        *m_ProjectileSystem, *m_CollisionSystem, *m_CollisionResponseSystem, *m_DamageSystem);
+
+    // ========================================
+    // JUGADOR
+    // ========================================
+    ConfigLoader::PlayerEntityConfig playerCfg = m_Config.GetPlayerEntity();
+    playerCfg.CalculateSpawnPosition(worldSize.width, worldSize.height);
+    EntityManager::CreatePlayer(m_World, m_Assets, playerCfg);
+}
+
+HeadlessMatch::~HeadlessMatch()
+{
+    // Los sistemas (fondo de WaveSystem) se destruyen después, pero antes que m_Assets
+    m_World.Clear();
+}
+
+MatchStats HeadlessMatch::Run(float maxSimulatedSeconds)
+{
+    MatchStats stats;
+    stats.seed = m_Seed;
+    stats.totalWaves = m_WaveManagerSystem->GetTotalWaves();
+    stats.result = "time_limit";
+
+    Uint64 start = SDL_GetTicksNS();
+    while (stats.simulatedSeconds < maxSimulatedSeconds)
+    {
+        // Mismo tick que Game::Update con paso fijo
+        m_World.AdvanceTimers(m_FixedDeltaTime);
+        m_Pipeline->Run(m_World, m_FixedDeltaTime);
+
+        ++stats.ticks;
+        stats.simulatedSeconds += m_FixedDeltaTime;
+        stats.peakEnemies = std::max(stats.peakEnemies, m_World.GetEnemies().size());
+
+        if (m_GameOver)
+        {
+            stats.result = "game_over";
+            break;
+        }
+
+        // Tras la última oleada WaveSystem ya no inicia otra
+        if (!m_WaveManagerSystem->IsWaveInProgress() &&
+            m_WaveManagerSystem->GetCurrentWave() + 1 >= stats.totalWaves)
+        {
+            stats.result = "waves_cleared";
+            break;
+        }
+    }
+    stats.wallSeconds = (SDL_GetTicksNS() - start) / 1e9;
+
+    // ========================================
+    // ESTADO FINAL
+    // ========================================
+    stats.waveReached = m_WaveManagerSystem->GetCurrentWave() + 1;
+    stats.enemiesAlive = m_World.GetEnemies().size();
+    if (Entity *player = m_World.GetPlayer())
+    {
+        if (auto *health = player->GetComponent<HealthComponent>())
+        {
+            stats.playerHp = health->hp;
+            stats.playerMaxHp = health->maxHp;
+        }
+    }
+    stats.stateHash = HashState();
+
+    return stats;
+}
+
+uint64_t HeadlessMatch::HashState()
+{
+    uint64_t hash = 14695981039346656037ull;
+    auto mix = [&hash](const void *data, size_t size)
+    {
+        const unsigned char *bytes = static_cast<const unsigned char *>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    };
+    auto mixTransform = [&mix](const Entity *entity)
+    {
+        if (auto *transform = entity->GetComponent<TransformComponent>())
+        {
+            mix(&transform->m_Position, sizeof(transform->m_Position));
+            mix(&transform->m_Velocity, sizeof(transform->m_Velocity));
+        }
+    };
+
+    const int wave = m_WaveManagerSystem->GetCurrentWave();
+    mix(&wave, sizeof(wave));
+
+    if (Entity *player = m_World.GetPlayer())
+    {
+        mixTransform(player);
+        if (auto *health = player->GetComponent<HealthComponent>())
+            mix(&health->hp, sizeof(health->hp));
+    }
+
+    // GetEnemies() sigue el orden de creación: igual en dos partidas con la misma semilla
+    for (const Entity *enemy : m_World.GetEnemies())
+        mixTransform(enemy);
+
+    return hash;
+}
+
+// ========================================
+// MatchServer
+// ========================================
+bool MatchServer::IsServerMode(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--server") == 0)
+            return true;
+    }
+    return false;
+}
+
+bool MatchServer::Initialize(int argc, char *argv[])
+{
+    // ========================================
+    // CARGAR CONFIGURACIÓN (una vez para todo el lote)
+    // ========================================
+    if (!m_Config.LoadSettings() || !m_Config.LoadGameConfigs())
+        return false;
+
+    m_Settings = m_Config.GetServer();
+    return ParseArgs(argc, argv);
+}
+
+bool MatchServer::ParseArgs(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--server")
+            continue;
+
+        if (arg == "--check-determinism")
+        {
+            m_Settings.checkDeterminism = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            spdlog::error("MatchServer: Falta el valor de {}", arg);
+            return false;
+        }
+
+        const std::string value = argv[++i];
+        try
+        {
+            if (arg == "--matches")
+                m_Settings.matches = std::stoi(value);
+            else if (arg == "--threads")
+                m_Settings.threads = std::stoi(value);
+            else if (arg == "--seed")
+                m_Settings.seed = static_cast<uint32_t>(std::stoul(value));
+            else if (arg == "--max-time")
+                m_Settings.maxMatchTime = std::stof(value);
+            else if (arg == "--out")
+                m_Settings.output = value;
+            else
+            {
+                spdlog::error("MatchServer: Argumento desconocido: {}", arg);
+                return false;
+            }
+        }
+        catch (const std::exception &)
+        {
+            spdlog::error("MatchServer: Valor inválido para {}: {}", arg, value);
+            return false;
+        }
+    }
+
+    if (m_Settings.matches <= 0)
+    {
+        spdlog::error("MatchServer: --matches debe ser mayor que 0");
+        return false;
+    }
+    return true;
+}
+
+bool MatchServer::Run()
+{
+    const size_t threads = m_Settings.threads > 0
+                               ? static_cast<size_t>(m_Settings.threads)
+                               : static_cast<size_t>(std::max(1u, std::thread::hardware_concurrency()));
+
+    spdlog::info("MatchServer: {} partidas en {} hilos (max {:.1f}s simulados, seed={})",
+                 m_Settings.matches, threads, m_Settings.maxMatchTime, m_Settings.seed);
+
+    // Los sistemas loguean cada oleada/spawn: silenciarlos durante el lote
+    const spdlog::level::level_enum previousLevel = spdlog::get_level();
+    spdlog::set_level(spdlog::level::warn);
+
+    JobSystem jobs(threads - 1);
+
+    Uint64 start = SDL_GetTicksNS();
+    RunBatch(jobs, m_Results);
+    double wallSeconds = (SDL_GetTicksNS() - start) / 1e9;
+
+    // Segunda pasada con las mismas semillas (fuera del tiempo medido)
+    std::vector<MatchStats> rerun;
+    if (m_Settings.checkDeterminism)
+        RunBatch(jobs, rerun);
+
+    spdlog::set_level(previousLevel);
+
+    const bool deterministic = !m_Settings.checkDeterminism || CompareRuns(rerun);
+    const bool reported = Report(wallSeconds, threads);
+    return deterministic && reported;
+}
+
+void MatchServer::RunBatch(JobSystem &jobs, std::vector<MatchStats> &results) const
+{
+    // ========================================
+    // LOTE: una partida por trabajo (el hilo que espera también ejecuta)
+    // ========================================
+    results.assign(static_cast<size_t>(m_Settings.matches), MatchStats());
+    JobCounter counter;
+
+    for (uint32_t i = 0; i < results.size(); ++i)
+    {
+        jobs.Submit([this, i, &results]()
+                    {
+                        HeadlessMatch match(m_Config, m_Settings.seed + i);
+                        MatchStats stats = match.Run(m_Settings.maxMatchTime);
+                        stats.matchIndex = i;
+                        results[i] = std::move(stats); },
+                    counter);
+    }
+    jobs.Wait(counter);
+}
+
+bool MatchServer::CompareRuns(const std::vector<MatchStats> &rerun) const
+{
+    size_t mismatches = 0;
+    for (size_t i = 0; i < m_Results.size(); ++i)
+    {
+        const MatchStats &a = m_Results[i];
+        const MatchStats &b = rerun[i];
+        if (a.result == b.result && a.ticks == b.ticks && a.stateHash == b.stateHash)
+            continue;
+
+        ++mismatches;
+        spdlog::error("MatchServer: Partida {} (seed={}) no es determinista: {} / {} ticks / {:016x} vs {} / {} ticks / {:016x}",
+                      a.matchIndex, a.seed, a.result, a.ticks, a.stateHash, b.result, b.ticks, b.stateHash);
+    }
+
+    if (mismatches > 0)
+    {
+        spdlog::error("MatchServer: {} de {} partidas difieren al repetirlas", mismatches, m_Results.size());
+        return false;
+    }
+
+    spdlog::info("Determinismo: {} partidas repetidas con el mismo resultado", m_Results.size());
+    return true;
+}
+
+bool MatchServer::Report(double wallSeconds, size_t threads) const
+{
+    // ========================================
+    // AGREGADOS
+    // ========================================
+    double simulatedSeconds = 0.0;
+    double matchSeconds = 0.0;
+    uint64_t ticks = 0;
+    double waveSum = 0.0;
+    std::map<std::string, int> outcomes;
+    for (const MatchStats &stats : m_Results)
+    {
+        simulatedSeconds += stats.simulatedSeconds;
+        matchSeconds += stats.wallSeconds;
+        ticks += stats.ticks;
+        waveSum += stats.waveReached;
+        ++outcomes[stats.result];
+    }
+
+    const double count = static_cast<double>(m_Results.size());
+    const double safeWall = std::max(wallSeconds, 1e-9);
+
+    spdlog::info("=== MATCH SERVER ===");
+    spdlog::info("Partidas: {} en {:.2f}s ({} hilos)", m_Results.size(), wallSeconds, threads);
+    spdlog::info("Throughput: {:.2f} partidas/s, {:.0f} s simulados/s, {:.0f} ticks/s",
+                 count / safeWall, simulatedSeconds / safeWall, ticks / safeWall);
+    spdlog::info("Escalado: {:.2f}x (suma de tiempos de partida / tiempo real)", matchSeconds / safeWall);
+    spdlog::info("Media: ola {:.2f}, {:.1f}s de supervivencia", waveSum / count, simulatedSeconds / count);
+    for (const auto &[result, total] : outcomes)
+        spdlog::info("Resultado {}: {}", result, total);
+
+    if (m_Settings.output.empty())
+        return true;
+
+    // ========================================
+    // INFORME JSON
+    // ========================================
+    json report;
+    report["matches"] = m_Results.size();
+    report["threads"] = threads;
+    report["seed"] = m_Settings.seed;
+    report["max_match_time"] = m_Settings.maxMatchTime;
+    report["wall_seconds"] = wallSeconds;
+    report["matches_per_second"] = count / safeWall;
+    report["simulated_seconds_per_second"] = simulatedSeconds / safeWall;
+    report["ticks_per_second"] = ticks / safeWall;
+    report["parallel_speedup"] = matchSeconds / safeWall;
+    report["average_wave_reached"] = waveSum / count;
+    report["average_simulated_seconds"] = simulatedSeconds / count;
+    report["outcomes"] = outcomes;
+
+    json matches = json::array();
+    for (const MatchStats &stats : m_Results)
+    {
+        matches.push_back({{"index", stats.matchIndex},
+                           {"seed", stats.seed},
+                           {"result", stats.result},
+                           {"ticks", stats.ticks},
+                           {"simulated_seconds", stats.simulatedSeconds},
+                           {"wall_seconds", stats.wallSeconds},
+                           {"wave_reached", stats.waveReached},
+                           {"total_waves", stats.totalWaves},
+                           {"player_hp", stats.playerHp},
+                           {"player_max_hp", stats.playerMaxHp},
+                           {"enemies_alive", stats.enemiesAlive},
+                           {"peak_enemies", stats.peakEnemies},
+                           {"state_hash", stats.stateHash}});
+    }
+    report["match_results"] = std::move(matches);
+
+    std::ofstream file(m_Settings.output);
+    if (!file.is_open())
+    {
+        spdlog::error("MatchServer: No se pudo escribir {}", m_Settings.output);
+        return false;
+    }
+    file << report.dump(2) << '\n';
+    spdlog::info("Informe JSON: {}", m_Settings.output);
+    return true;
+}
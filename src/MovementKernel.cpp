@@ -0,0 +1,99 @@
+#include "MovementKernel.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MOVEMENT_KERNEL_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    // Un eje de una entidad (referencia escalar); compartido con la cola del camino SSE
+    inline void ConfineAxis(float &pos, float &vel, float size, float limit)
+    {
+        if (pos < 0.0f)
+        {
+            pos = 0.0f;
+            vel = -vel;
+        }
+        else if (pos + size > limit)
+        {
+            pos = limit - size;
+            vel = -vel;
+        }
+    }
+
+    inline void StepOne(MovementBatch &b, size_t i, float dt, float worldWidth, float worldHeight)
+    {
+        b.posX[i] += b.velX[i] * dt;
+        b.posY[i] += b.velY[i] * dt;
+        ConfineAxis(b.posX[i], b.velX[i], b.width[i], worldWidth);
+        ConfineAxis(b.posY[i], b.velY[i], b.height[i], worldHeight);
+    }
+
+#ifdef MOVEMENT_KERNEL_SSE
+    // Un eje de 4 entidades: mismas reglas que ConfineAxis, con máscaras
+    inline void ConfineAxis4(__m128 &pos, __m128 &vel, __m128 size, __m128 limit)
+    {
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 signBit = _mm_set1_ps(-0.0f);
+
+        const __m128 maxPos = _mm_sub_ps(limit, size);
+        const __m128 belowMin = _mm_cmplt_ps(pos, zero);
+        const __m128 aboveMax = _mm_andnot_ps(belowMin, _mm_cmpgt_ps(_mm_add_ps(pos, size), limit));
+
+        pos = _mm_or_ps(_mm_andnot_ps(_mm_or_ps(belowMin, aboveMax), pos), _mm_and_ps(aboveMax, maxPos));
+        vel = _mm_xor_ps(vel, _mm_and_ps(_mm_or_ps(belowMin, aboveMax), signBit));
+    }
+#endif
+}
+
+void MovementBatch::Resize(size_t count)
+{
+    posX.resize(count);
+    posY.resize(count);
+    velX.resize(count);
+    velY.resize(count);
+    width.resize(count);
+    height.resize(count);
+}
+
+void MovementKernel::StepScalar(MovementBatch &batch, float dt, float worldWidth, float worldHeight)
+{
+    const size_t count = batch.Size();
+    for (size_t i = 0; i < count; ++i)
+        StepOne(batch, i, dt, worldWidth, worldHeight);
+}
+
+void MovementKernel::Step(MovementBatch &batch, float dt, float worldWidth, float worldHeight)
+{
+#ifdef MOVEMENT_KERNEL_SSE
+    const size_t count = batch.Size();
+    const size_t simdCount = count & ~static_cast<size_t>(3);
+
+    const __m128 dts = _mm_set1_ps(dt);
+    const __m128 widthLimit = _mm_set1_ps(worldWidth);
+    const __m128 heightLimit = _mm_set1_ps(worldHeight);
+
+    for (size_t i = 0; i < simdCount; i += 4)
+    {
+        __m128 velX = _mm_loadu_ps(&batch.velX[i]);
+        __m128 velY = _mm_loadu_ps(&batch.velY[i]);
+        __m128 posX = _mm_add_ps(_mm_loadu_ps(&batch.posX[i]), _mm_mul_ps(velX, dts));
+        __m128 posY = _mm_add_ps(_mm_loadu_ps(&batch.posY[i]), _mm_mul_ps(velY, dts));
+
+        ConfineAxis4(posX, velX, _mm_loadu_ps(&batch.width[i]), widthLimit);
+        ConfineAxis4(posY, velY, _mm_loadu_ps(&batch.height[i]), heightLimit);
+
+        _mm_storeu_ps(&batch.posX[i], posX);
+        _mm_storeu_ps(&batch.posY[i], posY);
+        _mm_storeu_ps(&batch.velX[i], velX);
+        _mm_storeu_ps(&batch.velY[i], velY);
+    }
+
+    // Cola (count % 4) con la referencia escalar
+    for (size_t i = simdCount; i < count; ++i)
+        StepOne(batch, i, dt, worldWidth, worldHeight);
+#else
+    StepScalar(batch, dt, worldWidth, worldHeight);
+#endif
+}
@@ -0,0 +1,114 @@
+#include "ProjectilePool.h"
+#include <algorithm>
+
+ProjectilePool::ProjectilePool(size_t capacity)
+    : m_PosX(capacity, 0.0f), m_PosY(capacity, 0.0f),
+      m_PrevX(capacity, 0.0f), m_PrevY(capacity, 0.0f),
+      m_VelX(capacity, 0.0f), m_VelY(capacity, 0.0f),
+      m_TimeLeft(capacity, 0.0f), m_Damage(capacity, 0), m_Alive(capacity, 0),
+      m_HighWater(0), m_ActiveCount(0)
+{
+    m_FreeSlots.reserve(capacity);
+    Clear();
+}
+
+void ProjectilePool::Clear()
+{
+    std::fill(m_Alive.begin(), m_Alive.end(), 0);
+
+    // Pila en orden inverso: las ranuras bajas salen primero (rango activo compacto)
+    m_FreeSlots.clear();
+    for (size_t slot = m_Alive.size(); slot > 0; --slot)
+        m_FreeSlots.push_back(static_cast<uint32_t>(slot - 1));
+
+    m_HighWater = 0;
+    m_ActiveCount = 0;
+}
+
+bool ProjectilePool::Spawn(float x, float y, float vx, float vy, float lifetime, int damage)
+{
+    if (m_FreeSlots.empty())
+        return false;
+
+    const uint32_t slot = m_FreeSlots.back();
+    m_FreeSlots.pop_back();
+
+    m_PosX[slot] = m_PrevX[slot] = x;
+    m_PosY[slot] = m_PrevY[slot] = y;
+    m_VelX[slot] = vx;
+    m_VelY[slot] = vy;
+    m_TimeLeft[slot] = lifetime;
+    m_Damage[slot] = damage;
+    m_Alive[slot] = 1;
+
+    m_HighWater = std::max(m_HighWater, slot + 1);
+    ++m_ActiveCount;
+    return true;
+}
+
+void ProjectilePool::Kill(uint32_t slot)
+{
+    if (!m_Alive[slot])
+        return;
+
+    m_Alive[slot] = 0;
+    m_FreeSlots.push_back(slot); // Nunca supera la capacidad reservada
+    --m_ActiveCount;
+
+    while (m_HighWater > 0 && !m_Alive[m_HighWater - 1])
+        --m_HighWater;
+}
+
+void ProjectilePool::Integrate(float dt, float worldWidth, float worldHeight)
+{
+    const uint32_t count = m_HighWater;
+
+    // ========================================
+    // PASO 1: Integrar todas las ranuras del rango (sin ramas, vectorizable)
+    // ========================================
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        m_PrevX[i] = m_PosX[i];
+        m_PrevY[i] = m_PosY[i];
+        m_PosX[i] += m_VelX[i] * dt;
+        m_PosY[i] += m_VelY[i] * dt;
+        m_TimeLeft[i] -= dt;
+    }
+
+    // ========================================
+    // PASO 2: Expirar por tiempo o al salir del mundo (máscara, sin ramas)
+    // ========================================
+    uint32_t expiredCount = 0;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        // | en lugar de ||: se evalúan todas las comparaciones, sin saltos
+        const uint8_t expired = static_cast<uint8_t>((m_TimeLeft[i] <= 0.0f) |
+                                                     (m_PosX[i] < 0.0f) | (m_PosX[i] > worldWidth) |
+                                                     (m_PosY[i] < 0.0f) | (m_PosY[i] > worldHeight));
+        const uint8_t dies = m_Alive[i] & expired;
+        expiredCount += dies;
+        m_Alive[i] ^= dies;
+    }
+
+    // ========================================
+    // PASO 3: Compactar free list y rango activo (solo si alguno expiró)
+    // ========================================
+    if (expiredCount > 0)
+        RebuildFreeSlots();
+}
+
+void ProjectilePool::RebuildFreeSlots()
+{
+    // Mismo orden que Clear(): las ranuras bajas salen primero
+    m_FreeSlots.clear();
+    m_HighWater = 0;
+    for (size_t slot = m_Alive.size(); slot > 0; --slot)
+    {
+        const uint32_t index = static_cast<uint32_t>(slot - 1);
+        if (!m_Alive[index])
+            m_FreeSlots.push_back(index);
+        else if (m_HighWater == 0)
+            m_HighWater = index + 1;
+    }
+    m_ActiveCount = m_Alive.size() - m_FreeSlots.size();
+}
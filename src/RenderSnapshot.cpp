@@ -0,0 +1,89 @@
+#include "RenderSnapshot.h"
+#include <algorithm>
+#include <utility>
+
+// ========================================
+// CameraView
+// ========================================
+SDL_FRect CameraView::SweptBounds(float margin) const
+{
+    float left = std::min(previousX, x) - margin;
+    float top = std::min(previousY, y) - margin;
+    float right = std::max(previousX, x) + width + margin;
+    float bottom = std::max(previousY, y) + height + margin;
+    return SDL_FRect{left, top, right - left, bottom - top};
+}
+
+// ========================================
+// RenderSnapshot
+// ========================================
+void RenderSnapshot::Clear()
+{
+    frameIndex = 0;
+    publishNs = 0;
+    interpolationSpan = 0.0f;
+    elapsedTime = 0.0f;
+    gameOver = false;
+    camera = CameraView();
+    background = TextureHandle();
+    sprites.clear();
+    staticSprites.clear();
+    staticVersion = 0;
+    projectiles.clear();
+    projectileWidth = 0.0f;
+    projectileHeight = 0.0f;
+    hud = HudSnapshot();
+}
+
+float RenderSnapshot::InterpolationAt(Uint64 nowNs) const
+{
+    if (interpolationSpan <= 0.0f || nowNs <= publishNs)
+        return interpolationSpan <= 0.0f ? 1.0f : 0.0f;
+
+    float elapsed = static_cast<float>((nowNs - publishNs) / 1e9);
+    return std::min(1.0f, elapsed / interpolationSpan);
+}
+
+// ========================================
+// RenderSnapshotBuffer
+// ========================================
+RenderSnapshotBuffer::RenderSnapshotBuffer()
+    : m_WriteIndex(0), m_ReadyIndex(1), m_ReadIndex(2),
+      m_HasReady(false), m_HasRead(false), m_NextFrame(1)
+{
+}
+
+RenderSnapshot &RenderSnapshotBuffer::BeginWrite()
+{
+    RenderSnapshot &snapshot = m_Slots[m_WriteIndex];
+    snapshot.Clear();
+    return snapshot;
+}
+
+void RenderSnapshotBuffer::Publish()
+{
+    RenderSnapshot &snapshot = m_Slots[m_WriteIndex];
+    snapshot.publishNs = SDL_GetTicksNS();
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    snapshot.frameIndex = m_NextFrame++;
+
+    // Publicado sin leer: se descarta (el render siempre quiere el más reciente)
+    std::swap(m_WriteIndex, m_ReadyIndex);
+    m_HasReady = true;
+}
+
+const RenderSnapshot *RenderSnapshotBuffer::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_HasReady)
+        {
+            std::swap(m_ReadIndex, m_ReadyIndex);
+            m_HasReady = false;
+            m_HasRead = true;
+        }
+    }
+
+    return m_HasRead ? &m_Slots[m_ReadIndex] : nullptr;
+}
@@ -0,0 +1,37 @@
+#include "SpatialGrid.h"
+
+SpatialGrid::SpatialGrid(float worldWidth, float worldHeight, float cellSize)
+    : m_CellSize(std::max(1.0f, cellSize)),
+      m_Cols(std::max(1, static_cast<int>(std::ceil(worldWidth / std::max(1.0f, cellSize))))),
+      m_Rows(std::max(1, static_cast<int>(std::ceil(worldHeight / std::max(1.0f, cellSize)))))
+{
+    m_CellStart.assign(static_cast<size_t>(m_Cols) * m_Rows + 1, 0);
+}
+
+void SpatialGrid::Build(const float *xs, const float *ys, size_t count)
+{
+    const size_t cellCount = static_cast<size_t>(m_Cols) * m_Rows;
+
+    // PASO 1: Contar puntos por celda
+    std::fill(m_CellStart.begin(), m_CellStart.end(), 0);
+    m_CellOf.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint32_t cell = static_cast<uint32_t>(ClampRow(ys[i]) * m_Cols + ClampCol(xs[i]));
+        m_CellOf[i] = cell;
+        ++m_CellStart[cell + 1];
+    }
+
+    // PASO 2: Prefijo acumulado -> inicio de cada celda
+    for (size_t c = 0; c < cellCount; ++c)
+        m_CellStart[c + 1] += m_CellStart[c];
+
+    // PASO 3: Colocar índices (usa m_CellStart[c] como cursor y luego lo restaura)
+    m_Items.resize(count);
+    for (size_t i = 0; i < count; ++i)
+        m_Items[m_CellStart[m_CellOf[i]]++] = static_cast<uint32_t>(i);
+
+    for (size_t c = cellCount; c > 0; --c)
+        m_CellStart[c] = m_CellStart[c - 1];
+    m_CellStart[0] = 0;
+}
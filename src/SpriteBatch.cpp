@@ -0,0 +1,120 @@
+#include "SpriteBatch.h"
+
+SpriteBatch::SpriteBatch(SDL_Renderer *renderer)
+    : m_Renderer(renderer), m_Enabled(true), m_Texture(nullptr), m_TextureWidth(1.0f), m_TextureHeight(1.0f),
+      m_DrawCalls(0), m_Quads(0), m_LastDrawCalls(0), m_LastQuads(0)
+{
+}
+
+void SpriteBatch::Begin()
+{
+    m_Vertices.clear();
+    m_Indices.clear();
+    m_Texture = nullptr;
+    m_DrawCalls = 0;
+    m_Quads = 0;
+
+    // Los quads de color sólido usan el blend de dibujo (HUD semitransparente)
+    SDL_SetRenderDrawBlendMode(m_Renderer, SDL_BLENDMODE_BLEND);
+}
+
+void SpriteBatch::End()
+{
+    Flush();
+    m_LastDrawCalls = m_DrawCalls;
+    m_LastQuads = m_Quads;
+}
+
+void SpriteBatch::Flush()
+{
+    if (m_Indices.empty())
+        return;
+
+    SDL_RenderGeometry(m_Renderer, m_Texture, m_Vertices.data(), static_cast<int>(m_Vertices.size()),
+                       m_Indices.data(), static_cast<int>(m_Indices.size()));
+    ++m_DrawCalls;
+
+    m_Vertices.clear();
+    m_Indices.clear();
+}
+
+void SpriteBatch::BindTexture(SDL_Texture *texture)
+{
+    if (texture == m_Texture)
+        return;
+
+    Flush();
+    m_Texture = texture;
+    m_TextureWidth = 1.0f;
+    m_TextureHeight = 1.0f;
+    if (texture)
+        SDL_GetTextureSize(texture, &m_TextureWidth, &m_TextureHeight);
+}
+
+void SpriteBatch::AddSprite(SDL_Texture *texture, const SDL_FRect *source, const SDL_FRect &dst)
+{
+    if (!texture)
+        return;
+
+    BindTexture(texture);
+
+    float u0 = 0.0f, v0 = 0.0f, u1 = 1.0f, v1 = 1.0f;
+    if (source)
+    {
+        u0 = source->x / m_TextureWidth;
+        v0 = source->y / m_TextureHeight;
+        u1 = (source->x + source->w) / m_TextureWidth;
+        v1 = (source->y + source->h) / m_TextureHeight;
+    }
+
+    PushQuad(dst, u0, v0, u1, v1, SDL_FColor{1.0f, 1.0f, 1.0f, 1.0f});
+}
+
+void SpriteBatch::AddRect(const SDL_FRect &rect, SDL_FColor color)
+{
+    BindTexture(nullptr);
+    PushQuad(rect, 0.0f, 0.0f, 0.0f, 0.0f, color);
+}
+
+void SpriteBatch::AddOutline(const SDL_FRect &rect, SDL_FColor color)
+{
+    AddRect(SDL_FRect{rect.x, rect.y, rect.w, 1.0f}, color);
+    AddRect(SDL_FRect{rect.x, rect.y + rect.h - 1.0f, rect.w, 1.0f}, color);
+    AddRect(SDL_FRect{rect.x, rect.y + 1.0f, 1.0f, rect.h - 2.0f}, color);
+    AddRect(SDL_FRect{rect.x + rect.w - 1.0f, rect.y + 1.0f, 1.0f, rect.h - 2.0f}, color);
+}
+
+void SpriteBatch::AddGeometry(SDL_Texture *texture, const SDL_Vertex *vertices, int vertexCount, const int *indices,
+                              int indexCount)
+{
+    if (!texture || vertexCount <= 0 || indexCount <= 0)
+        return;
+
+    BindTexture(texture);
+
+    const int base = static_cast<int>(m_Vertices.size());
+    m_Vertices.insert(m_Vertices.end(), vertices, vertices + vertexCount);
+    for (int i = 0; i < indexCount; ++i)
+        m_Indices.push_back(base + indices[i]);
+    m_Quads += static_cast<uint32_t>(indexCount / 6);
+
+    if (!m_Enabled)
+        Flush();
+}
+
+void SpriteBatch::PushQuad(const SDL_FRect &dst, float u0, float v0, float u1, float v1, SDL_FColor color)
+{
+    const int base = static_cast<int>(m_Vertices.size());
+    m_Vertices.push_back(SDL_Vertex{{dst.x, dst.y}, color, {u0, v0}});
+    m_Vertices.push_back(SDL_Vertex{{dst.x + dst.w, dst.y}, color, {u1, v0}});
+    m_Vertices.push_back(SDL_Vertex{{dst.x + dst.w, dst.y + dst.h}, color, {u1, v1}});
+    m_Vertices.push_back(SDL_Vertex{{dst.x, dst.y + dst.h}, color, {u0, v1}});
+
+    // Dos triángulos: 0-1-2 y 0-2-3
+    m_Indices.insert(m_Indices.end(), {base, base + 1, base + 2, base, base + 2, base + 3});
+    ++m_Quads;
+
+    // Modo inmediato: una llamada por quad (lo que costaba antes del batching)
+    if (!m_Enabled)
+        Flush();
+}
@@ -0,0 +1,136 @@
+#include "SteeringBench.h"
+#include "SteeringKernel.h"
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+
+namespace
+{
+    constexpr size_t DEFAULT_ENEMIES = 10000;
+    constexpr int DEFAULT_ITERATIONS = 1000;
+    constexpr float TOLERANCE = 1e-4f; // Relativa; rsqrt + Newton queda en ~1e-6
+    constexpr float PLAYER_X = 640.0f;
+    constexpr float PLAYER_Y = 360.0f;
+
+    // Lote sintético: ~1/4 fuera de rango, la mitad con dirección de flujo
+    void FillBatch(SteeringBatch &b, size_t count)
+    {
+        std::mt19937 rng(1234u);
+        std::uniform_real_distribution<float> pos(-640.0f, 1920.0f);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> speed(80.0f, 220.0f);
+        std::uniform_real_distribution<float> range(300.0f, 1400.0f);
+        std::uniform_real_distribution<float> lerp(0.02f, 0.2f);
+
+        b.Resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            b.posX[i] = pos(rng);
+            b.posY[i] = pos(rng);
+            const bool useFlow = (i % 2) == 0;
+            b.dirX[i] = useFlow ? unit(rng) : 0.0f;
+            b.dirY[i] = useFlow ? unit(rng) : 0.0f;
+            b.velX[i] = unit(rng) * 100.0f;
+            b.velY[i] = unit(rng) * 100.0f;
+            b.steerX[i] = unit(rng) * 20.0f;
+            b.steerY[i] = unit(rng) * 20.0f;
+            b.speed[i] = speed(rng);
+            const float r = range(rng);
+            b.rangeSq[i] = r * r;
+            b.lerp[i] = lerp(rng);
+        }
+    }
+
+    // Tiempo medio por paso (ms) de un kernel sobre una copia del lote
+    template <typename Kernel>
+    double TimeKernel(const SteeringBatch &source, int iterations, Kernel kernel)
+    {
+        SteeringBatch batch = source;
+        const Uint64 start = SDL_GetTicksNS();
+        for (int i = 0; i < iterations; ++i)
+            kernel(batch, PLAYER_X, PLAYER_Y);
+        return (SDL_GetTicksNS() - start) / 1e6 / iterations;
+    }
+}
+
+bool SteeringBench::IsBenchmarkMode(int argc, char *argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--bench-steering") == 0)
+            return true;
+    }
+    return false;
+}
+
+bool SteeringBench::Run(int argc, char *argv[])
+{
+    // ========================================
+    // ARGUMENTOS: --bench-steering [enemigos] [iteraciones]
+    // ========================================
+    size_t count = DEFAULT_ENEMIES;
+    int iterations = DEFAULT_ITERATIONS;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--bench-steering") != 0)
+            continue;
+        try
+        {
+            if (i + 1 < argc)
+                count = static_cast<size_t>(std::stoul(argv[i + 1]));
+            if (i + 2 < argc)
+                iterations = std::stoi(argv[i + 2]);
+        }
+        catch (const std::exception &)
+        {
+            spdlog::error("SteeringBench: Argumentos inválidos para --bench-steering");
+            return false;
+        }
+    }
+    if (count == 0 || iterations <= 0)
+    {
+        spdlog::error("SteeringBench: enemigos e iteraciones deben ser mayores que 0");
+        return false;
+    }
+
+    SteeringBatch source;
+    FillBatch(source, count);
+
+    // ========================================
+    // EQUIVALENCIA: un paso de cada uno sobre el mismo lote
+    // ========================================
+    SteeringBatch scalar = source;
+    SteeringBatch simd = source;
+    SteeringKernel::StepScalar(scalar, PLAYER_X, PLAYER_Y);
+    SteeringKernel::Step(simd, PLAYER_X, PLAYER_Y);
+
+    float maxError = 0.0f;
+    size_t mismatches = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float errX = std::fabs(simd.velX[i] - scalar.velX[i]) / std::max(1.0f, std::fabs(scalar.velX[i]));
+        const float errY = std::fabs(simd.velY[i] - scalar.velY[i]) / std::max(1.0f, std::fabs(scalar.velY[i]));
+        const float err = std::max(errX, errY);
+        maxError = std::max(maxError, err);
+        if (err > TOLERANCE)
+            ++mismatches;
+    }
+
+    // ========================================
+    // TIEMPOS
+    // ========================================
+    const double scalarMs = TimeKernel(source, iterations, SteeringKernel::StepScalar);
+    const double simdMs = TimeKernel(source, iterations, SteeringKernel::Step);
+
+    spdlog::info("SteeringBench: {} enemigos x {} iteraciones", count, iterations);
+    spdlog::info("  StepScalar: {:.4f} ms/paso", scalarMs);
+    spdlog::info("  Step: {:.4f} ms/paso ({:.2f}x)", simdMs, simdMs > 0.0 ? scalarMs / simdMs : 0.0);
+    spdlog::info("  Error relativo máximo: {:.2e} (tolerancia {:.0e}), {} fuera de tolerancia",
+                 maxError, TOLERANCE, mismatches);
+
+    return mismatches == 0;
+}
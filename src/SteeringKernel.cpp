@@ -0,0 +1,122 @@
+#include "SteeringKernel.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define STEERING_KERNEL_SSE 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    constexpr float MIN_DISTANCE_SQ = 0.01f; // Equivale a distance > 0.1 del algoritmo original
+
+    // Un enemigo (referencia escalar); compartido con la cola del camino SSE
+    inline void StepOne(SteeringBatch &b, size_t i, float playerX, float playerY)
+    {
+        const float toX = playerX - b.posX[i];
+        const float toY = playerY - b.posY[i];
+        const float distSq = toX * toX + toY * toY;
+
+        if (distSq > b.rangeSq[i] || distSq <= MIN_DISTANCE_SQ)
+            return;
+
+        float dirX = b.dirX[i];
+        float dirY = b.dirY[i];
+        if (dirX == 0.0f && dirY == 0.0f)
+        {
+            dirX = toX;
+            dirY = toY;
+        }
+
+        const float invLength = 1.0f / std::sqrt(dirX * dirX + dirY * dirY);
+        const float targetX = dirX * invLength * b.speed[i] + b.steerX[i];
+        const float targetY = dirY * invLength * b.speed[i] + b.steerY[i];
+
+        b.velX[i] += (targetX - b.velX[i]) * b.lerp[i];
+        b.velY[i] += (targetY - b.velY[i]) * b.lerp[i];
+    }
+}
+
+void SteeringBatch::Resize(size_t count)
+{
+    posX.resize(count);
+    posY.resize(count);
+    dirX.resize(count);
+    dirY.resize(count);
+    velX.resize(count);
+    velY.resize(count);
+    steerX.resize(count);
+    steerY.resize(count);
+    speed.resize(count);
+    rangeSq.resize(count);
+    lerp.resize(count);
+}
+
+void SteeringKernel::StepScalar(SteeringBatch &batch, float playerX, float playerY)
+{
+    const size_t count = batch.Size();
+    for (size_t i = 0; i < count; ++i)
+        StepOne(batch, i, playerX, playerY);
+}
+
+void SteeringKernel::Step(SteeringBatch &batch, float playerX, float playerY)
+{
+#ifdef STEERING_KERNEL_SSE
+    const size_t count = batch.Size();
+    const size_t simdCount = count & ~static_cast<size_t>(3);
+
+    const __m128 playerXs = _mm_set1_ps(playerX);
+    const __m128 playerYs = _mm_set1_ps(playerY);
+    const __m128 minDistSq = _mm_set1_ps(MIN_DISTANCE_SQ);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+
+    for (size_t i = 0; i < simdCount; i += 4)
+    {
+        const __m128 posX = _mm_loadu_ps(&batch.posX[i]);
+        const __m128 posY = _mm_loadu_ps(&batch.posY[i]);
+        const __m128 toX = _mm_sub_ps(playerXs, posX);
+        const __m128 toY = _mm_sub_ps(playerYs, posY);
+        const __m128 distSq = _mm_add_ps(_mm_mul_ps(toX, toX), _mm_mul_ps(toY, toY));
+
+        // Máscara de rango: 0.01 < distSq <= rangeSq
+        const __m128 inRange = _mm_and_ps(_mm_cmple_ps(distSq, _mm_loadu_ps(&batch.rangeSq[i])),
+                                          _mm_cmpgt_ps(distSq, minDistSq));
+        if (_mm_movemask_ps(inRange) == 0)
+            continue; // Ninguno de los 4 en rango
+
+        // Dirección: la del campo de flujo, o directa si es (0,0)
+        __m128 dirX = _mm_loadu_ps(&batch.dirX[i]);
+        __m128 dirY = _mm_loadu_ps(&batch.dirY[i]);
+        const __m128 useDirect = _mm_and_ps(_mm_cmpeq_ps(dirX, zero), _mm_cmpeq_ps(dirY, zero));
+        dirX = _mm_or_ps(_mm_and_ps(useDirect, toX), _mm_andnot_ps(useDirect, dirX));
+        dirY = _mm_or_ps(_mm_and_ps(useDirect, toY), _mm_andnot_ps(useDirect, dirY));
+
+        // 1/sqrt aproximado + una iteración de Newton: y' = y * (1.5 - 0.5 * x * y²)
+        const __m128 lengthSq = _mm_add_ps(_mm_mul_ps(dirX, dirX), _mm_mul_ps(dirY, dirY));
+        __m128 invLength = _mm_rsqrt_ps(lengthSq);
+        const __m128 newton = _mm_mul_ps(_mm_mul_ps(half, lengthSq), _mm_mul_ps(invLength, invLength));
+        invLength = _mm_mul_ps(invLength, _mm_sub_ps(threeHalves, newton));
+
+        const __m128 scale = _mm_mul_ps(invLength, _mm_loadu_ps(&batch.speed[i]));
+        const __m128 targetX = _mm_add_ps(_mm_mul_ps(dirX, scale), _mm_loadu_ps(&batch.steerX[i]));
+        const __m128 targetY = _mm_add_ps(_mm_mul_ps(dirY, scale), _mm_loadu_ps(&batch.steerY[i]));
+
+        // Lerp solo en los carriles en rango (t = 0 en el resto)
+        const __m128 t = _mm_and_ps(inRange, _mm_loadu_ps(&batch.lerp[i]));
+        const __m128 velX = _mm_loadu_ps(&batch.velX[i]);
+        const __m128 velY = _mm_loadu_ps(&batch.velY[i]);
+        const __m128 deltaX = _mm_and_ps(inRange, _mm_sub_ps(targetX, velX));
+        const __m128 deltaY = _mm_and_ps(inRange, _mm_sub_ps(targetY, velY));
+        _mm_storeu_ps(&batch.velX[i], _mm_add_ps(velX, _mm_mul_ps(deltaX, t)));
+        _mm_storeu_ps(&batch.velY[i], _mm_add_ps(velY, _mm_mul_ps(deltaY, t)));
+    }
+
+    // Cola (count % 4) con la referencia escalar
+    for (size_t i = simdCount; i < count; ++i)
+        StepOne(batch, i, playerX, playerY);
+#else
+    StepScalar(batch, playerX, playerY);
+#endif
+}
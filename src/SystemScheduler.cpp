@@ -0,0 +1,181 @@
+#include "SystemScheduler.h"
+#include "SystemPipeline.h"
+#include "World.h"
+#include <spdlog/spdlog.h>
+#include <thread>
+
+namespace
+{
+    // ENTITIES es exclusivo: quien lo escribe conflictúa con todos
+    SystemAccess Normalize(SystemAccess access)
+    {
+        if (access.writes & SystemResource::ENTITIES)
+            access.writes = SystemResource::ALL & ~SystemResource::MAIN_THREAD;
+        return access;
+    }
+
+    bool Conflicts(const SystemAccess &a, const SystemAccess &b)
+    {
+        const uint32_t dataMask = ~static_cast<uint32_t>(SystemResource::MAIN_THREAD);
+        return ((a.writes & (b.reads | b.writes)) & dataMask) != 0 ||
+               ((b.writes & a.reads) & dataMask) != 0;
+    }
+}
+
+SystemScheduler::SystemScheduler(JobSystem &jobs)
+    : m_Jobs(jobs), m_ForceSerial(false), m_Ticks(0), m_World(nullptr), m_Dt(0.0f), m_Completed(0)
+{
+}
+
+void SystemScheduler::AddNode(ISystem &system, const std::string &name, UpdateFn update)
+{
+    m_Nodes.push_back(Node{&system, update, name, SystemAccess(), {}, 0, 0});
+    m_Remaining = std::make_unique<std::atomic<uint32_t>[]>(m_Nodes.size());
+}
+
+void SystemScheduler::BuildGraph()
+{
+    for (Node &node : m_Nodes)
+    {
+        node.access = Normalize(node.system->access());
+        node.successors.clear();
+        node.dependencyCount = 0;
+    }
+
+    // Arista i -> j solo hacia adelante: el DAG respeta el orden serie
+    for (uint32_t i = 0; i < m_Nodes.size(); ++i)
+    {
+        for (uint32_t j = i + 1; j < m_Nodes.size(); ++j)
+        {
+            if (!Conflicts(m_Nodes[i].access, m_Nodes[j].access))
+                continue;
+
+            m_Nodes[i].successors.push_back(j);
+            ++m_Nodes[j].dependencyCount;
+        }
+    }
+}
+
+void SystemScheduler::LogGraph()
+{
+    BuildGraph();
+    for (const Node &node : m_Nodes)
+    {
+        std::string successors;
+        for (uint32_t next : node.successors)
+            successors += (successors.empty() ? "" : ", ") + m_Nodes[next].name;
+
+        spdlog::info("Scheduler: {} (deps={}, main={}) -> [{}]", node.name, node.dependencyCount,
+                     (node.access.reads | node.access.writes) & SystemResource::MAIN_THREAD ? "si" : "no",
+                     successors);
+    }
+}
+
+void SystemScheduler::Dispatch(uint32_t node)
+{
+    const SystemAccess &access = m_Nodes[node].access;
+    if ((access.reads | access.writes) & SystemResource::MAIN_THREAD)
+    {
+        std::lock_guard<std::mutex> lock(m_MainReadyMutex);
+        m_MainReady.push_back(node);
+        return;
+    }
+
+    m_Jobs.Submit([this, node]()
+                  { Execute(node); },
+                  m_FrameJobs);
+}
+
+void SystemScheduler::Execute(uint32_t node)
+{
+    Node &current = m_Nodes[node];
+    {
+        // Cada nodo corre una vez por tick: su acumulador no se comparte entre hilos
+        ScopedStageTimer<PIPELINE_TIMING_ENABLED> timer(current.stageNs);
+        current.update(*current.system, *m_World, m_Dt);
+    }
+
+    // Nadie más corre en paralelo con un escritor de ENTITIES: reconstruir aquí es seguro
+    if (current.access.writes & SystemResource::ENTITIES)
+        m_World->RefreshCaches();
+
+    for (uint32_t next : current.successors)
+    {
+        if (m_Remaining[next].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            Dispatch(next);
+    }
+
+    m_Completed.fetch_add(1, std::memory_order_release);
+}
+
+void SystemScheduler::Run(World &world, float dt)
+{
+    // Las caches de World se reconstruyen perezosamente: dejarlas listas antes de repartir
+    world.RefreshCaches();
+    if constexpr (PIPELINE_TIMING_ENABLED)
+        ++m_Ticks;
+
+    // ========================================
+    // SERIE: orden de registro en el hilo actual
+    // ========================================
+    if (IsSerial())
+    {
+        for (Node &node : m_Nodes)
+        {
+            ScopedStageTimer<PIPELINE_TIMING_ENABLED> timer(node.stageNs);
+            node.update(*node.system, world, dt);
+        }
+        return;
+    }
+
+    // ========================================
+    // PARALELO: DAG del frame
+    // ========================================
+    BuildGraph();
+
+    m_World = &world;
+    m_Dt = dt;
+    m_Completed.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < m_Nodes.size(); ++i)
+        m_Remaining[i].store(m_Nodes[i].dependencyCount, std::memory_order_relaxed);
+
+    for (uint32_t i = 0; i < m_Nodes.size(); ++i)
+    {
+        if (m_Nodes[i].dependencyCount == 0)
+            Dispatch(i);
+    }
+
+    // El hilo que llama ejecuta los nodos MAIN_THREAD y, mientras tanto, ayuda con trabajos
+    while (m_Completed.load(std::memory_order_acquire) < m_Nodes.size())
+    {
+        uint32_t mainNode = UINT32_MAX;
+        {
+            std::lock_guard<std::mutex> lock(m_MainReadyMutex);
+            if (!m_MainReady.empty())
+            {
+                mainNode = m_MainReady.front();
+                m_MainReady.erase(m_MainReady.begin());
+            }
+        }
+
+        if (mainNode != UINT32_MAX)
+            Execute(mainNode);
+        else if (!m_Jobs.RunPendingJob())
+            std::this_thread::yield();
+    }
+
+    // Los trabajos marcan m_Completed antes de retornar: esperar a que salgan del todo
+    m_Jobs.Wait(m_FrameJobs);
+}
+
+void SystemScheduler::LogTimings() const
+{
+    if constexpr (PIPELINE_TIMING_ENABLED)
+    {
+        if (m_Ticks == 0)
+            return;
+
+        for (const Node &node : m_Nodes)
+            spdlog::info("Scheduler: {} {:.3f} ms/tick", node.name, node.stageNs / 1e6 / m_Ticks);
+    }
+}
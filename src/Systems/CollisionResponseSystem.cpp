@@ -7,16 +7,29 @@
 #include "../../include/Components/EnemyComponent.h"
 #include "../../include/Event.h"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <vector>
 
 CollisionResponseSystem::CollisionResponseSystem(const GameContext &ctx, float playerPush, float enemyPush)
-    : m_WorldWidth(ctx.worldWidth),
-      m_WorldHeight(ctx.worldHeight),
-      m_PlayerPushStrength(playerPush),
-      m_EnemyPushStrength(enemyPush)
+    : m_PlayerPushStrength(playerPush),
+      m_EnemyPushStrength(enemyPush),
+      m_WorldWidth(ctx.worldWidth),
+      m_WorldHeight(ctx.worldHeight)
 {
 }
 
+void CollisionResponseSystem::confine(Entity *entity, TransformComponent *transform) const
+{
+    glm::vec2 size(0.0f);
+    if (auto *collider = entity->GetComponent<ColliderComponent>())
+        size = collider->m_Bounds;
+
+    // Mismos límites que MovementKernel; una entidad mayor que el mundo queda en 0
+    glm::vec2 &position = transform->m_Position;
+    position.x = std::max(0.0f, std::min(position.x, m_WorldWidth - size.x));
+    position.y = std::max(0.0f, std::min(position.y, m_WorldHeight - size.y));
+}
+
 void CollisionResponseSystem::update(World &world, float dt)
 {
     std::unique_ptr<Event> event;
@@ -52,6 +65,7 @@ void CollisionResponseSystem::update(World &world, float dt)
                 // Aplicar push al jugador
                 glm::vec2 pushDirection(collisionEvent->pushDirectionX, collisionEvent->pushDirectionY);
                 transformA->m_Position += pushDirection * m_PlayerPushStrength;
+                confine(entityA, transformA);
 
                 // Emitir DamageEvent al jugador
                 auto damageEvent = std::make_unique<DamageEvent>(collisionEvent->entityA_Id, 1);
@@ -79,41 +93,8 @@ void CollisionResponseSystem::update(World &world, float dt)
                 // Invertir velocidades (rebote)
                 transformA->m_Velocity *= -1.0f;
                 transformB->m_Velocity *= -1.0f;
-
-                break;
-            }
-
-            case CollisionType::ENTITY_WORLD:
-            {
-                // Obtener collider para clamping
-                auto *collider = entityA->GetComponent<ColliderComponent>();
-                if (!collider)
-                    continue;
-
-                glm::vec2 pushDirection(collisionEvent->pushDirectionX, collisionEvent->pushDirectionY);
-
-                // Aplicar clamping y rebote
-                if (pushDirection.x > 0.0f) // Chocó con borde izquierdo
-                {
-                    transformA->m_Position.x = 0.f;
-                    transformA->m_Velocity.x *= -1.f;
-                }
-                else if (pushDirection.x < 0.0f) // Chocó con borde derecho
-                {
-                    transformA->m_Position.x = m_WorldWidth - collider->m_Bounds.x;
-                    transformA->m_Velocity.x *= -1.f;
-                }
-
-                if (pushDirection.y > 0.0f) // Chocó con borde superior
-                {
-                    transformA->m_Position.y = 0.f;
-                    transformA->m_Velocity.y *= -1.f;
-                }
-                else if (pushDirection.y < 0.0f) // Chocó con borde inferior
-                {
-                    transformA->m_Position.y = m_WorldHeight - collider->m_Bounds.y;
-                    transformA->m_Velocity.y *= -1.f;
-                }
+                confine(entityA, transformA);
+                confine(entityB, transformB);
 
                 break;
             }
@@ -127,6 +108,7 @@ void CollisionResponseSystem::update(World &world, float dt)
                 glm::vec2 pushDirection(collisionEvent->pushDirectionX, collisionEvent->pushDirectionY);
                 transformA->m_Position += pushDirection * m_PlayerPushStrength;
                 transformA->m_Velocity *= -1.0f;
+                confine(entityA, transformA);
 
                 break;
             }
@@ -140,6 +122,7 @@ void CollisionResponseSystem::update(World &world, float dt)
                 glm::vec2 pushDirection(collisionEvent->pushDirectionX, collisionEvent->pushDirectionY);
                 transformA->m_Position += pushDirection * m_EnemyPushStrength;
                 transformA->m_Velocity *= -1.0f;
+                confine(entityA, transformA);
 
                 break;
             }
@@ -6,12 +6,15 @@
 #include "../../include/Components/TransformComponent.h"
 #include "../../include/Components/ColliderComponent.h"
 #include "../../include/Event.h"
+#include "../../include/JobSystem.h"
 #include <spdlog/spdlog.h>
 
+// Filas mínimas por bloque de ENEMY_ENEMY (por debajo no compensa repartir)
+static constexpr size_t ENEMY_PAIR_MIN_ROWS = 64;
+
 CollisionSystem::CollisionSystem(const GameContext &ctx)
-    : m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight)
+    : m_Jobs(ctx.jobs)
 {
-    // Constructor simple, sin logging
 }
 
 bool CollisionSystem::checkAABBCollision(const glm::vec2 &pos1, const glm::vec2 &size1,
@@ -69,135 +72,99 @@ void CollisionSystem::checkPlayerEnemyCollisions(World &world)
 
 void CollisionSystem::checkEnemyEnemyCollisions(World &world)
 {
-    const auto &enemies = world.GetEnemies();
-
-    for (size_t i = 0; i < enemies.size(); ++i)
+    // ========================================
+    // PASO 1: Enemigos válidos (componentes resueltos una vez, no por par)
+    // ========================================
+    m_PairEntities.clear();
+    m_PairTransforms.clear();
+    m_PairColliders.clear();
+    for (Entity *enemy : world.GetEnemies())
     {
-        Entity *entityA = enemies[i];
-
-        auto *transformA = entityA->GetComponent<TransformComponent>();
-        auto *colliderA = entityA->GetComponent<ColliderComponent>();
-
-        if (!transformA || !colliderA)
+        auto *transform = enemy->GetComponent<TransformComponent>();
+        auto *collider = enemy->GetComponent<ColliderComponent>();
+        if (!transform || !collider)
             continue;
 
-        for (size_t j = i + 1; j < enemies.size(); ++j)
-        {
-            Entity *entityB = enemies[j];
-
-            auto *transformB = entityB->GetComponent<TransformComponent>();
-            auto *colliderB = entityB->GetComponent<ColliderComponent>();
-
-            if (!transformB || !colliderB)
-                continue;
-
-            if (!checkAABBCollision(transformA->m_Position, colliderA->m_Bounds,
-                                    transformB->m_Position, colliderB->m_Bounds))
-                continue;
+        m_PairEntities.push_back(enemy);
+        m_PairTransforms.push_back(transform);
+        m_PairColliders.push_back(collider);
+    }
 
-            glm::vec2 centerA = transformA->m_Position + (colliderA->m_Bounds * 0.5f);
-            glm::vec2 centerB = transformB->m_Position + (colliderB->m_Bounds * 0.5f);
-            glm::vec2 pushDirection = glm::normalize(centerA - centerB);
+    const size_t count = m_PairEntities.size();
+    if (count < 2)
+        return;
 
-            world.emit(std::make_unique<CollisionEvent>(
-                CollisionType::ENEMY_ENEMY,
-                entityA->m_Id,
-                entityB->m_Id,
-                pushDirection.x,
-                pushDirection.y));
-        }
+    // ========================================
+    // PASO 2: Bloques de filas con el mismo número de pares (la fila i tiene count-1-i)
+    // ========================================
+    const size_t blocks = m_Jobs ? m_Jobs->ChunkCount(count, ENEMY_PAIR_MIN_ROWS) : 1;
+    const size_t totalPairs = count * (count - 1) / 2;
+
+    m_RowStart.assign(blocks + 1, count);
+    m_RowStart[0] = 0;
+    size_t pairsBefore = 0;
+    size_t block = 1;
+    for (size_t row = 0; row < count && block < blocks; ++row)
+    {
+        while (block < blocks && pairsBefore >= totalPairs * block / blocks)
+            m_RowStart[block++] = row;
+        pairsBefore += count - 1 - row;
     }
-}
 
-void CollisionSystem::checkWorldBoundaries(World &world)
-{
-    Entity *player = world.GetPlayer();
-    if (player)
+    if (m_BlockHits.size() < blocks)
+        m_BlockHits.resize(blocks);
+
+    // ========================================
+    // PASO 3: Pares i < j por bloque (solo lecturas; salida propia de cada bloque)
+    // ========================================
+    auto testBlocks = [this](size_t firstBlock, size_t lastBlock)
     {
-        auto *t = player->GetComponent<TransformComponent>();
-        auto *c = player->GetComponent<ColliderComponent>();
-        if (t && c)
+        for (size_t b = firstBlock; b < lastBlock; ++b)
         {
-            bool collided = false;
-            glm::vec2 pushDirection(0.0f, 0.0f);
+            std::vector<EnemyPairHit> &hits = m_BlockHits[b];
+            hits.clear();
 
-            if (t->m_Position.x < 0.f)
-            {
-                pushDirection.x = 1.0f;
-                collided = true;
-            }
-            else if (t->m_Position.x + c->m_Bounds.x > m_WorldWidth)
-            {
-                pushDirection.x = -1.0f;
-                collided = true;
-            }
-
-            if (t->m_Position.y < 0.f)
-            {
-                pushDirection.y = 1.0f;
-                collided = true;
-            }
-            else if (t->m_Position.y + c->m_Bounds.y > m_WorldHeight)
+            for (size_t i = m_RowStart[b]; i < m_RowStart[b + 1]; ++i)
             {
-                pushDirection.y = -1.0f;
-                collided = true;
-            }
-
-            if (collided)
-            {
-                world.emit(std::make_unique<CollisionEvent>(
-                    CollisionType::ENTITY_WORLD,
-                    player->m_Id,
-                    0,
-                    pushDirection.x,
-                    pushDirection.y));
+                const TransformComponent *transformA = m_PairTransforms[i];
+                const ColliderComponent *colliderA = m_PairColliders[i];
+
+                for (size_t j = i + 1; j < m_PairEntities.size(); ++j)
+                {
+                    const TransformComponent *transformB = m_PairTransforms[j];
+                    const ColliderComponent *colliderB = m_PairColliders[j];
+
+                    if (!checkAABBCollision(transformA->m_Position, colliderA->m_Bounds,
+                                            transformB->m_Position, colliderB->m_Bounds))
+                        continue;
+
+                    glm::vec2 centerA = transformA->m_Position + (colliderA->m_Bounds * 0.5f);
+                    glm::vec2 centerB = transformB->m_Position + (colliderB->m_Bounds * 0.5f);
+                    hits.push_back({m_PairEntities[i]->m_Id, m_PairEntities[j]->m_Id,
+                                    glm::normalize(centerA - centerB)});
+                }
             }
         }
-    }
+    };
 
-    // Verificar enemigos
-    const auto &enemies = world.GetEnemies();
-    for (Entity *e : enemies)
-    {
-        auto *t = e->GetComponent<TransformComponent>();
-        auto *c = e->GetComponent<ColliderComponent>();
-
-        if (!t || !c)
-            continue;
+    if (m_Jobs)
+        m_Jobs->ParallelFor(blocks, 1, testBlocks);
+    else
+        testBlocks(0, blocks);
 
-        bool collided = false;
-        glm::vec2 pushDirection(0.0f, 0.0f);
-
-        if (t->m_Position.x < 0.f)
-        {
-            pushDirection.x = 1.0f;
-            collided = true;
-        }
-        else if (t->m_Position.x + c->m_Bounds.x > m_WorldWidth)
-        {
-            pushDirection.x = -1.0f;
-            collided = true;
-        }
-
-        if (t->m_Position.y < 0.f)
-        {
-            pushDirection.y = 1.0f;
-            collided = true;
-        }
-        else if (t->m_Position.y + c->m_Bounds.y > m_WorldHeight)
-        {
-            pushDirection.y = -1.0f;
-            collided = true;
-        }
-
-        if (collided)
+    // ========================================
+    // PASO 4: Emitir en orden de bloque (= orden serie i, j)
+    // ========================================
+    for (size_t b = 0; b < blocks; ++b)
+    {
+        for (const EnemyPairHit &hit : m_BlockHits[b])
         {
             world.emit(std::make_unique<CollisionEvent>(
-                CollisionType::ENTITY_WORLD,
-                e->m_Id,
-                0,
-                pushDirection.x,
-                pushDirection.y));
+                CollisionType::ENEMY_ENEMY,
+                hit.idA,
+                hit.idB,
+                hit.pushDirection.x,
+                hit.pushDirection.y));
         }
     }
 }
@@ -243,6 +210,12 @@ void CollisionSystem::checkEnemyObstacleCollisions(World &world)
 {
     const auto &enemies = world.GetEnemies();
     const auto &obstacles = world.GetObstacles();
+    if (obstacles.empty())
+        return;
+
+    // SDF de la fase: descarta en O(1) a los enemigos lejos de todo obstáculo
+    const DistanceField &obstacleField = world.GetObstacleField();
+    const bool useField = !obstacleField.IsEmpty();
 
     for (Entity *enemy : enemies)
     {
@@ -252,6 +225,15 @@ void CollisionSystem::checkEnemyObstacleCollisions(World &world)
         if (!enemyTransform || !enemyCollider)
             continue;
 
+        if (useField)
+        {
+            // El AABB cabe en el círculo de radio semidiagonal; GetCellSize() cubre el error de interpolación
+            const glm::vec2 center = enemyTransform->m_Position + enemyCollider->m_Bounds * 0.5f;
+            const float reach = 0.5f * glm::length(enemyCollider->m_Bounds) + obstacleField.GetCellSize();
+            if (obstacleField.Sample(center) > reach)
+                continue;
+        }
+
         for (Entity *obstacle : obstacles)
         {
             auto *obstacleTransform = obstacle->GetComponent<TransformComponent>();
@@ -280,7 +262,6 @@ void CollisionSystem::update(World &world, float dt)
 {
     checkPlayerEnemyCollisions(world);
     checkEnemyEnemyCollisions(world);
-    checkWorldBoundaries(world);
     checkPlayerObstacleCollisions(world);
     checkEnemyObstacleCollisions(world);
 }
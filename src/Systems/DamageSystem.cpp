@@ -2,10 +2,11 @@
 #include "../../include/Entity.h"
 #include "../../include/Components/HealthComponent.h"
 #include "../../include/Components/PlayerComponent.h"
+#include "../../include/Components/EnemyComponent.h"
 #include "../../include/Event.h"
 #include <spdlog/spdlog.h>
 
-DamageSystem::DamageSystem(bool *gameRunning, bool *gameOver, float invulnerabilityDuration)
+DamageSystem::DamageSystem(std::atomic<bool> *gameRunning, std::atomic<bool> *gameOver, float invulnerabilityDuration)
     : m_GameRunning(gameRunning),
       m_GameOver(gameOver),
       m_PlayerInvulnerabilityDuration(invulnerabilityDuration)
@@ -33,11 +34,27 @@ void DamageSystem::update(World &world, float dt)
         {
             DamageEvent *damageEvent = static_cast<DamageEvent *>(event.get());
 
+            // Buscar la entidad objetivo (O(1) con el nuevo GetEntityById)
+            Entity *targetEntity = world.FindEntityById(damageEvent->entityId);
+
+            // Enemigo (impacto de proyectil): sin HealthComponent muere al primer golpe
+            if (targetEntity && targetEntity->GetComponent<EnemyComponent>())
+            {
+                auto *health = targetEntity->GetComponent<HealthComponent>();
+                if (health)
+                    health->takeDamage(damageEvent->damage);
+
+                if (!health || health->isDead())
+                {
+                    spdlog::debug("Enemigo {} eliminado por proyectil", targetEntity->m_Id);
+                    world.deleteEntity(targetEntity->m_Id);
+                }
+                continue;
+            }
+
             spdlog::warn("Procesando DamageEvent: Entidad={}, Danio={}",
                          damageEvent->entityId, damageEvent->damage);
 
-            // Buscar la entidad objetivo (O(1) con el nuevo GetEntityById)
-            Entity *targetEntity = world.FindEntityById(damageEvent->entityId);
             if (targetEntity)
             {
                 // Verificar si es el jugador y está invulnerable
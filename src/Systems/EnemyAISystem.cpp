@@ -1,13 +1,315 @@
 #include "../../include/Systems/EnemyAISystem.h"
+#include "../../include/Game.h"
 #include "../../include/Entity.h"
 #include "../../include/Components/EnemyComponent.h"
 #include "../../include/Components/PlayerComponent.h"
 #include "../../include/Components/TransformComponent.h"
+#include "../../include/Components/ColliderComponent.h"
+#include "../../include/JobSystem.h"
 #include <glm/glm.hpp>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
 
-EnemyAISystem::EnemyAISystem()
+// Enemigos mínimos por trozo al calcular la dirección en paralelo
+static constexpr size_t STEER_MIN_CHUNK = 64;
+
+EnemyAISystem::EnemyAISystem(const GameContext &ctx, const ConfigLoader::AIConfig &config, const BehaviorTable &behaviors)
+    : m_Config(config),
+      m_FlowField(ctx.worldWidth, ctx.worldHeight, config.flowFieldCellSize),
+      m_ObstacleVersion(0),
+      m_HasObstacleLayout(false),
+      m_EnemyVersion(0),
+      m_HasAgents(false),
+      m_LodCursor(0),
+      m_NeighborGrid(ctx.worldWidth, ctx.worldHeight, config.separationRadius),
+      m_Behaviors(behaviors),
+      m_ActionStart{},
+      m_RngState(0x9E3779B9u),
+      m_ObstacleField(nullptr),
+      m_Jobs(ctx.jobs)
+{
+    // Sin tipos cargados: estado 0 = persecución clásica
+    if (m_Behaviors.GetStateCount() == 0)
+        m_Behaviors.AddType("default", BehaviorTable::TypeDef());
+}
+
+void EnemyAISystem::SeedRng(World &world)
+{
+    // xorshift32 no sale nunca del estado 0
+    m_RngState = static_cast<uint32_t>(world.GetRng()());
+    if (m_RngState == 0)
+        m_RngState = 0x9E3779B9u;
+}
+
+void EnemyAISystem::refreshAgents(World &world)
+{
+    uint32_t enemyVersion = world.GetEnemyVersion();
+    if (m_HasAgents && enemyVersion == m_EnemyVersion)
+        return;
+
+    m_Agents.clear();
+    for (Entity *enemy : world.GetEnemies())
+    {
+        auto *enemyComp = enemy->GetComponent<EnemyComponent>();
+        auto *enemyTransform = enemy->GetComponent<TransformComponent>();
+
+        if (!enemyComp || !enemyTransform)
+            continue;
+
+        m_Agents.push_back({enemyComp, enemyTransform, enemy->GetComponent<ColliderComponent>()});
+    }
+
+    m_EnemyVersion = enemyVersion;
+    m_HasAgents = true;
+}
+
+void EnemyAISystem::selectAgent(uint32_t agentIndex)
+{
+    EnemyComponent *ai = m_Agents[agentIndex].ai;
+    m_Selected.push_back(agentIndex);
+    m_SelectedDt.push_back(ai->aiAccumulatedTime);
+    ai->aiAccumulatedTime = 0.0f;
+}
+
+void EnemyAISystem::runTransitions(const glm::vec2 &playerPosition)
+{
+    constexpr size_t actionCount = static_cast<size_t>(BehaviorAction::Count);
+    std::array<uint32_t, actionCount> counts{};
+
+    // PASO 1: Transiciones (tabla plana, primera que se cumpla)
+    for (size_t k = 0; k < m_Selected.size(); ++k)
+    {
+        const Agent &agent = m_Agents[m_Selected[k]];
+        EnemyComponent *ai = agent.ai;
+        ai->stateTime += m_SelectedDt[k];
+
+        const glm::vec2 toPlayer = playerPosition - agent.transform->m_Position;
+        const float distanceSq = glm::dot(toPlayer, toPlayer);
+
+        uint16_t next = m_Behaviors.Evaluate(ai->behaviorState, distanceSq, ai->stateTime);
+        if (next != ai->behaviorState)
+        {
+            ai->behaviorState = next;
+            ai->stateTime = 0.0f;
+
+            // Dash fija su dirección al entrar
+            if (m_Behaviors.GetState(next).action == BehaviorAction::Dash && distanceSq > 0.01f)
+                ai->heading = toPlayer / std::sqrt(distanceSq);
+        }
+
+        ++counts[static_cast<size_t>(m_Behaviors.GetState(ai->behaviorState).action)];
+    }
+
+    // PASO 2: Agrupar por acción (counting sort estable)
+    m_ActionStart[0] = 0;
+    for (size_t a = 0; a < actionCount; ++a)
+        m_ActionStart[a + 1] = m_ActionStart[a] + counts[a];
+
+    std::array<uint32_t, actionCount> cursor;
+    std::copy(m_ActionStart.begin(), m_ActionStart.begin() + actionCount, cursor.begin());
+
+    m_ActionOrder.resize(m_Selected.size());
+    for (size_t k = 0; k < m_Selected.size(); ++k)
+    {
+        const size_t action = static_cast<size_t>(m_Behaviors.GetState(m_Agents[m_Selected[k]].ai->behaviorState).action);
+        m_ActionOrder[cursor[action]++] = static_cast<uint32_t>(k);
+    }
+}
+
+void EnemyAISystem::enqueueChase(uint32_t selectedIndex)
+{
+    const uint32_t agentIndex = m_Selected[selectedIndex];
+    Agent &agent = m_Agents[agentIndex];
+
+    // Limitar a 1: con LOD el dt acumulado puede ser varios frames
+    float lerpFactor = std::min(1.0f, agent.ai->velocitySmoothing * m_SelectedDt[selectedIndex]);
+
+    const glm::vec2 &position = agent.transform->m_Position;
+    const glm::vec2 &velocity = agent.transform->m_Velocity;
+
+    // Dirección del campo de flujo (rodea obstáculos); (0,0) = persecución directa
+    glm::vec2 flowDirection(0.0f);
+    if (m_Config.flowFieldEnabled)
+    {
+        glm::vec2 center = position;
+        if (agent.collider)
+            center += agent.collider->m_Bounds * 0.5f;
+        flowDirection = m_FlowField.Sample(center);
+    }
+
+    m_Batch.posX.push_back(position.x);
+    m_Batch.posY.push_back(position.y);
+    m_Batch.dirX.push_back(flowDirection.x);
+    m_Batch.dirY.push_back(flowDirection.y);
+    m_Batch.velX.push_back(velocity.x);
+    m_Batch.velY.push_back(velocity.y);
+    m_Batch.speed.push_back(agent.ai->baseSpeed * m_Behaviors.GetState(agent.ai->behaviorState).speedScale);
+    m_Batch.rangeSq.push_back(agent.ai->focusRange * agent.ai->focusRange);
+    m_Batch.lerp.push_back(lerpFactor);
+    m_BatchAgent.push_back(agentIndex);
+
+    // computeSteer se rellena después para todo el lote (en paralelo)
+    m_Batch.steerX.push_back(0.0f);
+    m_Batch.steerY.push_back(0.0f);
+}
+
+template <BehaviorAction Action>
+void EnemyAISystem::runAction(const glm::vec2 &playerPosition)
+{
+    const size_t begin = m_ActionStart[static_cast<size_t>(Action)];
+    const size_t end = m_ActionStart[static_cast<size_t>(Action) + 1];
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const uint32_t selectedIndex = m_ActionOrder[i];
+        const uint32_t agentIndex = m_Selected[selectedIndex];
+        const Agent &agent = m_Agents[agentIndex];
+        EnemyComponent *ai = agent.ai;
+        const BehaviorState &state = m_Behaviors.GetState(ai->behaviorState);
+        const float elapsed = m_SelectedDt[selectedIndex];
+        const float speed = ai->baseSpeed * state.speedScale;
+
+        const glm::vec2 toPlayer = playerPosition - agent.transform->m_Position;
+        const float distance = glm::length(toPlayer);
+
+        // Velocidad objetivo según la acción del grupo (resuelta en compilación)
+        glm::vec2 target(0.0f);
+        if constexpr (Action == BehaviorAction::Wander)
+        {
+            float turn = nextSigned() * state.turnRate * elapsed;
+            float c = std::cos(turn);
+            float s = std::sin(turn);
+            ai->heading = glm::vec2(ai->heading.x * c - ai->heading.y * s,
+                                    ai->heading.x * s + ai->heading.y * c);
+            target = ai->heading * speed;
+        }
+        else if constexpr (Action == BehaviorAction::Flee)
+        {
+            if (distance > 0.1f)
+                target = -toPlayer / distance * speed;
+        }
+        else if constexpr (Action == BehaviorAction::Orbit)
+        {
+            if (distance > 0.1f)
+            {
+                // Tangente + corrección radial hacia el radio deseado
+                glm::vec2 radial = toPlayer / distance;
+                glm::vec2 tangent(-radial.y, radial.x);
+                float correction = std::clamp((distance - state.radius) / std::max(1.0f, state.radius), -1.0f, 1.0f);
+                target = glm::normalize(tangent + radial * correction) * speed;
+            }
+        }
+        else if constexpr (Action == BehaviorAction::Dash)
+        {
+            target = ai->heading * speed;
+        }
+        // Idle: target = 0 (frenar)
+
+        if constexpr (Action != BehaviorAction::Idle)
+            target += computeSteer(agentIndex);
+
+        float lerpFactor = std::min(1.0f, ai->velocitySmoothing * elapsed);
+        glm::vec2 &velocity = agent.transform->m_Velocity;
+        velocity += (target - velocity) * lerpFactor;
+    }
+}
+
+float EnemyAISystem::nextSigned()
 {
+    m_RngState ^= m_RngState << 13;
+    m_RngState ^= m_RngState >> 17;
+    m_RngState ^= m_RngState << 5;
+    return static_cast<float>(m_RngState) * (2.0f / 4294967295.0f) - 1.0f;
+}
+
+glm::vec2 EnemyAISystem::computeSeparation(uint32_t agentIndex) const
+{
+    const float radius = m_Config.separationRadius;
+    const float radiusSq = radius * radius;
+    const float selfX = m_CenterX[agentIndex];
+    const float selfY = m_CenterY[agentIndex];
+
+    glm::vec2 separation(0.0f);
+    glm::vec2 neighborSum(0.0f);
+    int neighborCount = 0;
+
+    m_NeighborGrid.Query(selfX, selfY, radius, [&](uint32_t other)
+    {
+        if (other == agentIndex)
+            return;
+
+        const float offsetX = selfX - m_CenterX[other];
+        const float offsetY = selfY - m_CenterY[other];
+        const float distSq = offsetX * offsetX + offsetY * offsetY;
+        if (distSq >= radiusSq)
+            return;
+
+        neighborSum += glm::vec2(m_CenterX[other], m_CenterY[other]);
+        ++neighborCount;
+
+        // Centros coincidentes: sin dirección definida, la colisión los separa
+        if (distSq < 0.0001f)
+            return;
+
+        // Más fuerte cuanto más cerca: (1 - d/r) en la dirección opuesta al vecino
+        const float dist = std::sqrt(distSq);
+        const float falloff = (1.0f - dist / radius) / dist;
+        separation.x += offsetX * falloff;
+        separation.y += offsetY * falloff;
+    });
+
+    if (neighborCount == 0)
+        return glm::vec2(0.0f);
+
+    // Limitar a longitud 1 para que una multitud densa no supere baseSpeed * weight
+    const float separationLength = glm::length(separation);
+    if (separationLength > 1.0f)
+        separation /= separationLength;
+
+    glm::vec2 steer = separation * m_Config.separationWeight;
+
+    if (m_Config.cohesionWeight > 0.0f)
+    {
+        glm::vec2 toCenter = neighborSum / static_cast<float>(neighborCount) - glm::vec2(selfX, selfY);
+        const float centerDistance = glm::length(toCenter);
+        if (centerDistance > 0.01f)
+            steer += toCenter / centerDistance * m_Config.cohesionWeight;
+    }
+
+    return steer * m_Agents[agentIndex].ai->baseSpeed;
+}
+
+glm::vec2 EnemyAISystem::computeAvoidance(uint32_t agentIndex, const DistanceField &field) const
+{
+    const Agent &agent = m_Agents[agentIndex];
+
+    glm::vec2 center = agent.transform->m_Position;
+    float radius = 0.0f;
+    if (agent.collider)
+    {
+        center += agent.collider->m_Bounds * 0.5f;
+        radius = 0.5f * std::max(agent.collider->m_Bounds.x, agent.collider->m_Bounds.y);
+    }
+
+    const float clearance = field.Sample(center) - radius;
+    const float avoidDistance = std::max(1.0f, m_Config.obstacleAvoidDistance);
+    if (clearance >= avoidDistance)
+        return glm::vec2(0.0f);
+
+    // 0 en el borde de la zona, 1 al tocar (o dentro del obstáculo)
+    const float strength = std::clamp(1.0f - clearance / avoidDistance, 0.0f, 1.0f);
+    return field.Gradient(center) * (strength * m_Config.obstacleAvoidWeight * agent.ai->baseSpeed);
+}
+
+glm::vec2 EnemyAISystem::computeSteer(uint32_t agentIndex) const
+{
+    glm::vec2 steer(0.0f);
+    if (m_Config.separationEnabled)
+        steer += computeSeparation(agentIndex);
+    if (m_ObstacleField)
+        steer += computeAvoidance(agentIndex, *m_ObstacleField);
+    return steer;
 }
 
 void EnemyAISystem::update(World &world, float dt)
@@ -21,28 +323,158 @@ void EnemyAISystem::update(World &world, float dt)
     if (!playerTransform)
         return;
 
-    // ✅ Actualizar solo enemigos
-    const auto &enemies = world.GetEnemies();
-    for (Entity *enemy : enemies)
+    // ========================================
+    // FLOW FIELD: recalcular solo si cambió algo
+    // ========================================
+    if (m_Config.flowFieldEnabled)
     {
-        auto *enemyComp = enemy->GetComponent<EnemyComponent>();
-        auto *enemyTransform = enemy->GetComponent<TransformComponent>();
+        uint32_t obstacleVersion = world.GetObstacleVersion();
+        if (!m_HasObstacleLayout || obstacleVersion != m_ObstacleVersion)
+        {
+            m_FlowField.SetObstacles(world.GetObstacles(), m_Config.flowFieldClearance);
+            m_ObstacleVersion = obstacleVersion;
+            m_HasObstacleLayout = true;
+        }
 
-        if (!enemyComp || !enemyTransform)
-            continue;
+        auto *playerCollider = player->GetComponent<ColliderComponent>();
+        glm::vec2 playerCenter = playerTransform->m_Position;
+        if (playerCollider)
+            playerCenter += playerCollider->m_Bounds * 0.5f;
 
-        // Calcular distancia al jugador
-        glm::vec2 direction = playerTransform->m_Position - enemyTransform->m_Position;
-        float distance = glm::length(direction);
+        m_FlowField.Update(playerCenter);
+    }
+
+    refreshAgents(world);
+    if (m_Agents.empty())
+        return;
+
+    const glm::vec2 playerPosition = playerTransform->m_Position;
+    const DistanceField &obstacleField = world.GetObstacleField();
+    m_ObstacleField = (m_Config.obstacleAvoidEnabled && !obstacleField.IsEmpty()) ? &obstacleField : nullptr;
+    m_Selected.clear();
+    m_SelectedDt.clear();
+
+    // ========================================
+    // SEPARACIÓN: indexar centros de todos los enemigos
+    // ========================================
+    if (m_Config.separationEnabled)
+    {
+        m_CenterX.resize(m_Agents.size());
+        m_CenterY.resize(m_Agents.size());
+        for (size_t i = 0; i < m_Agents.size(); ++i)
+        {
+            glm::vec2 center = m_Agents[i].transform->m_Position;
+            if (m_Agents[i].collider)
+                center += m_Agents[i].collider->m_Bounds * 0.5f;
+            m_CenterX[i] = center.x;
+            m_CenterY[i] = center.y;
+        }
+        m_NeighborGrid.Build(m_CenterX.data(), m_CenterY.data(), m_Agents.size());
+    }
+
+    // ========================================
+    // PASO 1: Cercanos (cada frame)
+    // ========================================
+    const float nearDistanceSq = m_Config.lodNearDistance * m_Config.lodNearDistance;
+    size_t farCount = 0;
+    m_SelectedThisFrame.assign(m_Agents.size(), 0);
+
+    for (uint32_t i = 0; i < m_Agents.size(); ++i)
+    {
+        Agent &agent = m_Agents[i];
+        agent.ai->aiAccumulatedTime += dt;
+
+        if (m_Config.lodEnabled)
+        {
+            glm::vec2 offset = playerPosition - agent.transform->m_Position;
+            if (glm::dot(offset, offset) > nearDistanceSq)
+            {
+                ++farCount; // Se procesa en la rodaja round-robin
+                continue;
+            }
+        }
+
+        m_SelectedThisFrame[i] = 1;
+        selectAgent(i);
+    }
 
-        // Solo modificar velocidad si el jugador está dentro del rango
-        if (distance <= enemyComp->focusRange && distance > 0.1f)
+    // ========================================
+    // PASO 2: Lejanos (rodaja round-robin con presupuesto)
+    // ========================================
+    if (farCount > 0)
+    {
+        const size_t interval = static_cast<size_t>(std::max(1, m_Config.lodFarInterval));
+        size_t sliceSize = (farCount + interval - 1) / interval;
+
+        // El presupuesto solo recorta la rodaja: los cercanos nunca se saltan, pero lo
+        // consumen primero; al menos 1 lejano avanza por frame
+        const size_t nearCount = m_Agents.size() - farCount;
+        const size_t budget = static_cast<size_t>(std::max(0, m_Config.maxUpdatesPerFrame));
+        const size_t remaining = budget > nearCount ? budget - nearCount : 0;
+        sliceSize = std::max<size_t>(1, std::min(sliceSize, remaining));
+
+        size_t updated = 0;
+        size_t index = m_LodCursor % m_Agents.size();
+        for (size_t visited = 0; visited < m_Agents.size() && updated < sliceSize; ++visited)
         {
-            direction = glm::normalize(direction);
-            glm::vec2 targetVelocity = direction * enemyComp->baseSpeed;
+            uint32_t agentIndex = static_cast<uint32_t>(index);
+            index = (index + 1) % m_Agents.size();
 
-            float lerpFactor = enemyComp->velocitySmoothing * dt;
-            enemyTransform->m_Velocity = glm::mix(enemyTransform->m_Velocity, targetVelocity, lerpFactor);
+            // Los cercanos ya se seleccionaron este frame
+            if (m_SelectedThisFrame[agentIndex])
+                continue;
+
+            selectAgent(agentIndex);
+            ++updated;
         }
+
+        m_LodCursor = index;
+    }
+
+    // ========================================
+    // PASO 3: Transiciones de estado + agrupación por acción
+    // ========================================
+    runTransitions(playerPosition);
+
+    // ========================================
+    // PASO 4: Un bucle por acción
+    // ========================================
+    runAction<BehaviorAction::Wander>(playerPosition);
+    runAction<BehaviorAction::Flee>(playerPosition);
+    runAction<BehaviorAction::Orbit>(playerPosition);
+    runAction<BehaviorAction::Dash>(playerPosition);
+    runAction<BehaviorAction::Idle>(playerPosition);
+
+    // Chase: lote SoA + SteeringKernel
+    m_Batch.Resize(0);
+    m_BatchAgent.clear();
+    const size_t chaseBegin = m_ActionStart[static_cast<size_t>(BehaviorAction::Chase)];
+    const size_t chaseEnd = m_ActionStart[static_cast<size_t>(BehaviorAction::Chase) + 1];
+    for (size_t i = chaseBegin; i < chaseEnd; ++i)
+        enqueueChase(m_ActionOrder[i]);
+
+    // Separación + evitación: solo lecturas por enemigo, cada trozo escribe sus propias entradas
+    auto computeSteers = [this](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            glm::vec2 steer = computeSteer(m_BatchAgent[i]);
+            m_Batch.steerX[i] = steer.x;
+            m_Batch.steerY[i] = steer.y;
+        }
+    };
+
+    if (m_Jobs)
+        m_Jobs->ParallelFor(m_BatchAgent.size(), STEER_MIN_CHUNK, computeSteers);
+    else
+        computeSteers(0, m_BatchAgent.size());
+
+    SteeringKernel::Step(m_Batch, playerPosition.x, playerPosition.y);
+
+    for (size_t i = 0; i < m_BatchAgent.size(); ++i)
+    {
+        TransformComponent *transform = m_Agents[m_BatchAgent[i]].transform;
+        transform->m_Velocity.x = m_Batch.velX[i];
+        transform->m_Velocity.y = m_Batch.velY[i];
     }
 }
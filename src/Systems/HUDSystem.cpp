@@ -6,27 +6,87 @@
 #include <spdlog/spdlog.h>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <cstdio>
+
+namespace
+{
+    // Panel HUD (fondo semi-transparente en la esquina superior izquierda)
+    const int PANEL_WIDTH = 360; // Ancho del fondo negro
+    const int PANEL_HEIGHT = 75; // Alto del fondo negro (cajas + línea de texto)
+    const int PADDING = 15;      // Distancia desde las esquinas
+
+    // Barra de salud del jugador
+    const int BAR_X = PADDING * 2;
+    const int BAR_Y = PADDING * 2;
+    const int HP_BOX_SIZE = 20; // Tamaño de cada caja de HP
+    const int HP_SPACING = 4;   // Espacio entre cajas
+
+    // Texto (BitmapFont): HP junto a las cajas, oleada/tiempo debajo
+    const float TEXT_SCALE = 2.0f;              // 5x7 → 10x14 píxeles
+    const int TEXT_Y = BAR_Y + HP_BOX_SIZE + 8; // Línea de oleada y tiempo
+    const int HP_TEXT_Y = BAR_Y + (HP_BOX_SIZE - static_cast<int>(BitmapFont::GLYPH_HEIGHT * TEXT_SCALE)) / 2;
+    const SDL_FColor TEXT_COLOR{1.0f, 1.0f, 1.0f, 1.0f};
+
+    // Lectura de FPS: se refresca pocas veces por segundo (el texto no cambia cada frame)
+    const double FPS_REFRESH_SECONDS = 0.5;
+}
 
 HUDSystem::HUDSystem(const GameContext &ctx)
-    : m_Renderer(ctx.renderer), m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight)
+    : m_Renderer(ctx.renderer), m_Batch(ctx.batch), m_ScreenWidth(ctx.viewWidth), m_ScreenHeight(ctx.viewHeight),
+      m_Snapshot(nullptr), m_PanelLayer(ctx.renderer), m_CacheLayers(true), m_FpsWindowStartNs(0), m_LastDrawNs(0),
+      m_FpsFrames(0), m_FrameTimeSumMs(0.0), m_FpsLabel()
 {
+    // Atlas de glifos: una sola vez (sin renderer, p. ej. headless, no hay texto)
+    if (m_Renderer)
+        m_Font.Load(m_Renderer);
 }
 
 void HUDSystem::renderRectangle(int x, int y, int width, int height, int r, int g, int b, int a)
 {
-    SDL_SetRenderDrawColor(m_Renderer, r, g, b, a);
     SDL_FRect rect{static_cast<float>(x), static_cast<float>(y), static_cast<float>(width), static_cast<float>(height)};
-    SDL_RenderFillRect(m_Renderer, &rect);
+    m_Batch->AddRect(rect, SDL_FColor{r / 255.0f, g / 255.0f, b / 255.0f, a / 255.0f});
+}
+
+void HUDSystem::renderText(TextBlock &block, const char *text, int x, int y)
+{
+    if (!m_Font.IsLoaded())
+        return;
+
+    // Solo se remaqueta si el texto cambió; los vértices van al lote del atlas de glifos
+    block.Set(m_Font, text, static_cast<float>(x), static_cast<float>(y), TEXT_SCALE, TEXT_COLOR);
+    block.Draw(*m_Batch, m_Font);
 }
 
-void HUDSystem::renderText(const std::string &text, int x, int y)
+void HUDSystem::UpdateFps()
 {
-    // Función reservada para futuras mejoras con SDL_ttf
+    Uint64 now = SDL_GetTicksNS();
+    if (m_LastDrawNs == 0)
+    {
+        m_LastDrawNs = now;
+        m_FpsWindowStartNs = now;
+        return;
+    }
+
+    m_FrameTimeSumMs += (now - m_LastDrawNs) / 1e6;
+    m_LastDrawNs = now;
+    ++m_FpsFrames;
+
+    double windowSeconds = (now - m_FpsWindowStartNs) / 1e9;
+    if (windowSeconds < FPS_REFRESH_SECONDS)
+        return;
+
+    std::snprintf(m_FpsLabel, sizeof(m_FpsLabel), "%.0f FPS  %.1f MS", m_FpsFrames / windowSeconds,
+                  m_FrameTimeSumMs / m_FpsFrames);
+
+    m_FpsWindowStartNs = now;
+    m_FpsFrames = 0;
+    m_FrameTimeSumMs = 0.0;
 }
 
 void HUDSystem::update(World &world, float dt)
 {
-    if (!m_Renderer)
+    if (!m_Snapshot)
         return;
 
     // Encontrar al jugador (O(1) - acceso directo, sin iteración)
@@ -41,33 +101,26 @@ void HUDSystem::update(World &world, float dt)
     if (!playerComp || !healthComp)
         return;
 
-    // ========================================
-    // RENDERIZAR INFORMACIÓN EN PANTALLA
-    // ========================================
-
-    // Panel HUD (fondo semi-transparente en la esquina superior izquierda)
-    const int PANEL_WIDTH = 250; // Ancho del fondo negro
-    const int PANEL_HEIGHT = 50; // Alto del fondo negro
-    const int PADDING = 15;      // Distancia desde las esquinas
+    m_Snapshot->hud.visible = true;
+    m_Snapshot->hud.hp = healthComp->hp;
+    m_Snapshot->hud.maxHp = healthComp->maxHp;
+}
 
+void HUDSystem::DrawPanel(const HudSnapshot &hud)
+{
     // Fondo del HUD
     renderRectangle(PADDING, PADDING, PANEL_WIDTH, PANEL_HEIGHT, 0, 0, 0, 180);
 
     // ========================================
     // BARRA DE SALUD DEL JUGADOR
     // ========================================
-    const int BAR_X = PADDING * 2;
-    const int BAR_Y = PADDING * 2;
-    const int HP_BOX_SIZE = 20; // Tamaño de cada caja de HP
-    const int HP_SPACING = 4;   // Espacio entre cajas
-
     // Mostrar HP como cajas: verde (vida) y gris (perdida)
     // Cada caja representa 1 HP
-    for (int i = 0; i < healthComp->maxHp; i++)
+    for (int i = 0; i < hud.maxHp; i++)
     {
         int boxX = BAR_X + (i * (HP_BOX_SIZE + HP_SPACING));
 
-        if (i < healthComp->hp)
+        if (i < hud.hp)
         {
             // Verde: HP actual
             renderRectangle(boxX, BAR_Y, HP_BOX_SIZE, HP_BOX_SIZE, 50, 200, 50, 255);
@@ -79,11 +132,59 @@ void HUDSystem::update(World &world, float dt)
         }
 
         // Borde de cada caja
-        SDL_SetRenderDrawColor(m_Renderer, 200, 200, 200, 200);
         SDL_FRect boxBorder{static_cast<float>(boxX), static_cast<float>(BAR_Y), static_cast<float>(HP_BOX_SIZE), static_cast<float>(HP_BOX_SIZE)};
-        SDL_RenderRect(m_Renderer, &boxBorder);
+        m_Batch->AddOutline(boxBorder, SDL_FColor{200 / 255.0f, 200 / 255.0f, 200 / 255.0f, 200 / 255.0f});
+    }
+}
+
+void HUDSystem::Draw(const RenderSnapshot &snapshot)
+{
+    if (!m_Renderer || !m_Batch || !snapshot.hud.visible)
+        return;
+
+    const HudSnapshot &hud = snapshot.hud;
+
+    // ========================================
+    // PANEL + CAJAS DE HP (capa cacheada: solo cambia con el HP)
+    // ========================================
+    const uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(hud.maxHp)) << 32) |
+                         static_cast<uint32_t>(hud.hp);
+    const int width = std::max(PADDING + PANEL_WIDTH, BAR_X + hud.maxHp * (HP_BOX_SIZE + HP_SPACING));
+    const int height = PADDING + PANEL_HEIGHT;
+
+    if (m_CacheLayers && !m_PanelLayer.IsValid(key) && m_PanelLayer.Begin(*m_Batch, width, height))
+    {
+        DrawPanel(hud);
+        m_PanelLayer.End(*m_Batch, key);
+    }
+
+    if (m_CacheLayers && m_PanelLayer.IsValid(key))
+    {
+        // Coordenadas de pantalla = coordenadas de la capa (origen en la esquina)
+        m_Batch->AddSprite(m_PanelLayer.GetTexture(), nullptr,
+                           SDL_FRect{0.0f, 0.0f, m_PanelLayer.GetWidth(), m_PanelLayer.GetHeight()});
+    }
+    else
+    {
+        DrawPanel(hud);
     }
 
-    // Mostrar texto numérico: HP/MaxHP
-    const int TEXT_Y = BAR_Y + HP_BOX_SIZE + 8;
+    // ========================================
+    // TEXTO (un lote: todos los bloques comparten el atlas de glifos)
+    // ========================================
+    char text[64];
+
+    std::snprintf(text, sizeof(text), "%d/%d", hud.hp, hud.maxHp);
+    renderText(m_HpText, text, BAR_X + hud.maxHp * (HP_BOX_SIZE + HP_SPACING) + 4, HP_TEXT_Y);
+
+    // Décimas de segundo: el bloque se remaqueta 10 veces por segundo, no cada frame
+    std::snprintf(text, sizeof(text), "OLEADA %d/%d  TIEMPO %.1f", hud.wave, hud.totalWaves, snapshot.elapsedTime);
+    renderText(m_StatusText, text, BAR_X, TEXT_Y);
+
+    UpdateFps();
+    if (m_FpsLabel[0] != '\0')
+    {
+        int fpsX = static_cast<int>(m_ScreenWidth - PADDING - m_Font.Measure(m_FpsLabel, TEXT_SCALE));
+        renderText(m_FpsText, m_FpsLabel, fpsX, PADDING);
+    }
 }
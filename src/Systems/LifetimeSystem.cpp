@@ -63,6 +63,14 @@ void LifetimeSystem::update(World &world, float dt)
 
             // Evento procesado, no re-emitir
         }
+        else if (event->getType() == "TimerEvent" &&
+                 static_cast<TimerEvent *>(event.get())->tag == TimerTag::ENEMY_LIFETIME)
+        {
+            // ✅ Despawn por lifetime: el enemigo puede haber muerto antes (IDs no se reutilizan)
+            auto *timerEvent = static_cast<TimerEvent *>(event.get());
+            if (world.FindEntityById(timerEvent->entityId))
+                world.deleteEntity(timerEvent->entityId);
+        }
         else
         {
             // ⚠️ No es mi evento, guardarlo para re-emitir después
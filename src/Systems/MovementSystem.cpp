@@ -1,30 +1,83 @@
 #include "../../include/Systems/MovementSystem.h"
+#include "../../include/Game.h"
 #include "../../include/Entity.h"
 #include "../../include/Components/TransformComponent.h"
+#include "../../include/Components/ColliderComponent.h"
 
-MovementSystem::MovementSystem()
+MovementSystem::MovementSystem(const GameContext &ctx)
+    : m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight),
+      m_EnemyVersion(0), m_HasEnemyCache(false)
 {
 }
 
+void MovementSystem::refreshEnemies(World &world)
+{
+    uint32_t enemyVersion = world.GetEnemyVersion();
+    if (m_HasEnemyCache && enemyVersion == m_EnemyVersion)
+        return;
+
+    m_EnemyTransforms.clear();
+    m_EnemyWidths.clear();
+    m_EnemyHeights.clear();
+    for (Entity *enemy : world.GetEnemies())
+    {
+        auto *transform = enemy->GetComponent<TransformComponent>();
+        if (!transform)
+            continue;
+
+        // Sin collider: tamaño 0 (se confina solo su esquina)
+        auto *collider = enemy->GetComponent<ColliderComponent>();
+        m_EnemyTransforms.push_back(transform);
+        m_EnemyWidths.push_back(collider ? collider->m_Bounds.x : 0.0f);
+        m_EnemyHeights.push_back(collider ? collider->m_Bounds.y : 0.0f);
+    }
+
+    m_EnemyVersion = enemyVersion;
+    m_HasEnemyCache = true;
+}
+
+void MovementSystem::enqueue(TransformComponent *transform, float width, float height)
+{
+    transform->m_PreviousPosition = transform->m_Position;
+
+    m_Batch.posX.push_back(transform->m_Position.x);
+    m_Batch.posY.push_back(transform->m_Position.y);
+    m_Batch.velX.push_back(transform->m_Velocity.x);
+    m_Batch.velY.push_back(transform->m_Velocity.y);
+    m_Batch.width.push_back(width);
+    m_Batch.height.push_back(height);
+    m_BatchOwners.push_back(transform);
+}
+
 void MovementSystem::update(World &world, float dt)
 {
-    // Actualizar jugador
+    m_Batch.Resize(0);
+    m_BatchOwners.clear();
+
+    // PASO 1: Empaquetar jugador + enemigos
     Entity *player = world.GetPlayer();
     if (player)
     {
         auto *transform = player->GetComponent<TransformComponent>();
+        auto *collider = player->GetComponent<ColliderComponent>();
         if (transform)
-        {
-            transform->m_Position += transform->m_Velocity * dt;
-        }
+            enqueue(transform, collider ? collider->m_Bounds.x : 0.0f, collider ? collider->m_Bounds.y : 0.0f);
     }
 
-    // Actualizar enemigos (caché optimizado)
-    const auto &enemies = world.GetEnemies();
-    for (const auto &enemy : enemies)
+    refreshEnemies(world);
+    for (size_t i = 0; i < m_EnemyTransforms.size(); ++i)
+        enqueue(m_EnemyTransforms[i], m_EnemyWidths[i], m_EnemyHeights[i]);
+
+    // PASO 2: Integrar + confinar (una pasada SIMD)
+    MovementKernel::Step(m_Batch, dt, m_WorldWidth, m_WorldHeight);
+
+    // PASO 3: Escribir resultados
+    for (size_t i = 0; i < m_BatchOwners.size(); ++i)
     {
-        auto *transform = enemy->GetComponent<TransformComponent>();
-        if (transform)
-            transform->m_Position += transform->m_Velocity * dt;
+        TransformComponent *transform = m_BatchOwners[i];
+        transform->m_Position.x = m_Batch.posX[i];
+        transform->m_Position.y = m_Batch.posY[i];
+        transform->m_Velocity.x = m_Batch.velX[i];
+        transform->m_Velocity.y = m_Batch.velY[i];
     }
 }
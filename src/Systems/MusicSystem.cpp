@@ -2,7 +2,7 @@
 #include <cstring>
 
 MusicSystem::MusicSystem()
-    : m_MusicStream(nullptr), m_AudioDevice(0), m_AudioBuffer(nullptr),
+    : m_MusicStream(nullptr), m_AudioDevice(0), m_Spec{}, m_AudioBuffer(nullptr),
       m_AudioLen(0), m_AudioPos(0), m_IsPlaying(false)
 {
 }
@@ -13,6 +13,11 @@ MusicSystem::~MusicSystem()
 }
 
 bool MusicSystem::LoadMusic(const std::string &filePath)
+{
+    return DecodeMusic(filePath) && OpenStream();
+}
+
+bool MusicSystem::DecodeMusic(const std::string &filePath)
 {
     spdlog::info("Intentando cargar música desde: {}", filePath);
 
@@ -20,11 +25,10 @@ bool MusicSystem::LoadMusic(const std::string &filePath)
     Cleanup();
 
     // Cargar archivo de audio (solo WAV con SDL_LoadWAV)
-    SDL_AudioSpec spec;
     Uint8 *audioBuf = nullptr;
     Uint32 audioLen = 0;
 
-    if (!SDL_LoadWAV(filePath.c_str(), &spec, &audioBuf, &audioLen))
+    if (!SDL_LoadWAV(filePath.c_str(), &m_Spec, &audioBuf, &audioLen))
     {
         spdlog::error("No se pudo cargar la música desde: {}", filePath);
         spdlog::error("SDL Error: {}", SDL_GetError());
@@ -32,15 +36,22 @@ bool MusicSystem::LoadMusic(const std::string &filePath)
     }
 
     spdlog::info("✓ Archivo de música cargado: {} bytes", audioLen);
-    spdlog::info("  Formato: {} canales, {} Hz", spec.channels, spec.freq);
+    spdlog::info("  Formato: {} canales, {} Hz", m_Spec.channels, m_Spec.freq);
 
     // Guardar buffer en miembros de la clase
     m_AudioBuffer = audioBuf;
     m_AudioLen = audioLen;
     m_AudioPos = 0;
+    return true;
+}
+
+bool MusicSystem::OpenStream()
+{
+    if (!m_AudioBuffer)
+        return false;
 
     // Crear stream de audio (sin dispositivo específico)
-    m_MusicStream = SDL_CreateAudioStream(&spec, &spec);
+    m_MusicStream = SDL_CreateAudioStream(&m_Spec, &m_Spec);
     if (!m_MusicStream)
     {
         spdlog::error("No se pudo crear stream de audio: {}", SDL_GetError());
@@ -61,7 +72,7 @@ bool MusicSystem::LoadMusic(const std::string &filePath)
     }
 
     // Abrir dispositivo de audio DEFAULT
-    m_AudioDevice = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    m_AudioDevice = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &m_Spec);
     if (m_AudioDevice == 0)
     {
         spdlog::error("No se pudo abrir dispositivo de audio: {}", SDL_GetError());
@@ -7,23 +7,12 @@
 #include <algorithm>
 
 PlayerInputSystem::PlayerInputSystem(const GameContext &ctx, float playerSpeed)
-    : m_PlayerSpeed(playerSpeed), m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight), m_KeyState(nullptr)
+    : m_PlayerSpeed(playerSpeed), m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight)
 {
 }
 
-void PlayerInputSystem::updateKeyState()
-{
-    m_KeyState = SDL_GetKeyboardState(nullptr);
-}
-
 void PlayerInputSystem::update(World &world, float dt)
 {
-    // Actualizar estado del teclado
-    updateKeyState();
-
-    if (!m_KeyState)
-        return;
-
     // ✅ Obtener jugador con O(1) en lugar de iterar todas las entidades
     Entity *entity = world.GetPlayer();
     if (!entity)
@@ -41,24 +30,14 @@ void PlayerInputSystem::update(World &world, float dt)
 
     // Calcular velocidad basada en input WASD
     // Frame-rate independent: velocidad se multiplica por dt en MovementSystem
+    // Cada tecla pesa la fracción del tick que estuvo pulsada: un toque más
+    // corto que un tick mueve en proporción en lugar de perderse o contar entero
     glm::vec2 velocity(0.0f, 0.0f);
 
-    if (m_KeyState[SDL_SCANCODE_W])
-    {
-        velocity.y -= m_PlayerSpeed;
-    }
-    if (m_KeyState[SDL_SCANCODE_S])
-    {
-        velocity.y += m_PlayerSpeed;
-    }
-    if (m_KeyState[SDL_SCANCODE_A])
-    {
-        velocity.x -= m_PlayerSpeed;
-    }
-    if (m_KeyState[SDL_SCANCODE_D])
-    {
-        velocity.x += m_PlayerSpeed;
-    }
+    velocity.y -= m_PlayerSpeed * world.GetKeyHeldFraction(SDL_SCANCODE_W);
+    velocity.y += m_PlayerSpeed * world.GetKeyHeldFraction(SDL_SCANCODE_S);
+    velocity.x -= m_PlayerSpeed * world.GetKeyHeldFraction(SDL_SCANCODE_A);
+    velocity.x += m_PlayerSpeed * world.GetKeyHeldFraction(SDL_SCANCODE_D);
 
     // La velocidad se multiplica por dt en MovementSystem
     // Esto asegura que el movimiento sea consistente independientemente del frame rate
@@ -0,0 +1,172 @@
+#include "../../include/Systems/ProjectileSystem.h"
+#include "../../include/Game.h"
+#include "../../include/Entity.h"
+#include "../../include/Components/TransformComponent.h"
+#include "../../include/Components/ColliderComponent.h"
+#include "../../include/Event.h"
+#include <algorithm>
+#include <cmath>
+
+// Tamaño de celda de la rejilla de enemigos (del orden del collider de un enemigo)
+static constexpr float ENEMY_GRID_CELL_SIZE = 128.0f;
+
+ProjectileSystem::ProjectileSystem(const GameContext &ctx, const ConfigLoader::ProjectileConfig &config)
+    : m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight),
+      m_Config(config), m_Cooldown(0.0f), m_Facing(1.0f, 0.0f),
+      m_Pool(static_cast<size_t>(std::max(1, config.capacity))),
+      m_EnemyGrid(ctx.worldWidth, ctx.worldHeight, ENEMY_GRID_CELL_SIZE),
+      m_MaxEnemyReach(0.0f), m_EnemyVersion(0), m_HasEnemyCache(false)
+{
+}
+
+void ProjectileSystem::fire(World &world, float dt)
+{
+    m_Cooldown = std::max(0.0f, m_Cooldown - dt);
+
+    Entity *player = world.GetPlayer();
+    if (!player)
+        return;
+
+    auto *transform = player->GetComponent<TransformComponent>();
+    if (!transform)
+        return;
+
+    // Mirar hacia donde se movió por última vez (quieto = conserva la dirección)
+    if (transform->m_Velocity.x != 0.0f || transform->m_Velocity.y != 0.0f)
+        m_Facing = glm::normalize(transform->m_Velocity);
+
+    // Un toque de ESPACIO dentro del tick también dispara
+    if (!world.WasKeyDown(SDL_SCANCODE_SPACE) || m_Cooldown > 0.0f)
+        return;
+
+    auto *collider = player->GetComponent<ColliderComponent>();
+    glm::vec2 center = transform->m_Position + (collider ? collider->m_Bounds * 0.5f : glm::vec2(0.0f));
+    glm::vec2 velocity = m_Facing * m_Config.speed;
+
+    // Pool lleno: el disparo se pierde (sin allocation)
+    m_Pool.Spawn(center.x, center.y, velocity.x, velocity.y, m_Config.lifetime, m_Config.damage);
+    m_Cooldown = m_Config.fireRate > 0.0f ? 1.0f / m_Config.fireRate : 0.0f;
+}
+
+void ProjectileSystem::refreshEnemies(World &world)
+{
+    uint32_t enemyVersion = world.GetEnemyVersion();
+    if (m_HasEnemyCache && enemyVersion == m_EnemyVersion)
+        return;
+
+    m_EnemyTransforms.clear();
+    m_EnemyIds.clear();
+    m_EnemyHalfSizes.clear();
+    m_MaxEnemyReach = 0.0f;
+    for (Entity *enemy : world.GetEnemies())
+    {
+        auto *transform = enemy->GetComponent<TransformComponent>();
+        auto *collider = enemy->GetComponent<ColliderComponent>();
+        if (!transform || !collider)
+            continue;
+
+        glm::vec2 halfSize = collider->m_Bounds * 0.5f;
+        m_EnemyTransforms.push_back(transform);
+        m_EnemyIds.push_back(enemy->m_Id);
+        m_EnemyHalfSizes.push_back(halfSize);
+        m_MaxEnemyReach = std::max(m_MaxEnemyReach, glm::length(halfSize));
+    }
+
+    m_EnemyX.resize(m_EnemyTransforms.size());
+    m_EnemyY.resize(m_EnemyTransforms.size());
+    m_EnemyVersion = enemyVersion;
+    m_HasEnemyCache = true;
+}
+
+void ProjectileSystem::resolveHits(World &world)
+{
+    refreshEnemies(world);
+    if (m_EnemyTransforms.empty() || m_Pool.GetActiveCount() == 0)
+        return;
+
+    // ========================================
+    // PASO 1: Rejilla de centros de enemigos del tick
+    // ========================================
+    for (size_t i = 0; i < m_EnemyTransforms.size(); ++i)
+    {
+        m_EnemyX[i] = m_EnemyTransforms[i]->m_Position.x + m_EnemyHalfSizes[i].x;
+        m_EnemyY[i] = m_EnemyTransforms[i]->m_Position.y + m_EnemyHalfSizes[i].y;
+    }
+    m_EnemyGrid.Build(m_EnemyX.data(), m_EnemyY.data(), m_EnemyX.size());
+
+    // ========================================
+    // PASO 2: Cada proyectil consulta solo las celdas cercanas
+    // ========================================
+    const glm::vec2 projectileHalf(m_Config.width * 0.5f, m_Config.height * 0.5f);
+    const float reach = glm::length(projectileHalf) + m_MaxEnemyReach;
+
+    const uint32_t count = m_Pool.GetHighWater();
+    for (uint32_t slot = 0; slot < count; ++slot)
+    {
+        if (!m_Pool.IsAlive(slot))
+            continue;
+
+        const float px = m_Pool.GetX(slot);
+        const float py = m_Pool.GetY(slot);
+        uint32_t hitEnemy = UINT32_MAX;
+
+        m_EnemyGrid.Query(px, py, reach, [&](uint32_t enemy)
+                          {
+            if (hitEnemy != UINT32_MAX)
+                return;
+
+            // AABB exacto (centro-centro contra suma de semitamaños)
+            if (std::abs(px - m_EnemyX[enemy]) <= projectileHalf.x + m_EnemyHalfSizes[enemy].x &&
+                std::abs(py - m_EnemyY[enemy]) <= projectileHalf.y + m_EnemyHalfSizes[enemy].y)
+                hitEnemy = enemy; });
+
+        if (hitEnemy == UINT32_MAX)
+            continue;
+
+        world.emit(std::make_unique<DamageEvent>(m_EnemyIds[hitEnemy], m_Pool.GetDamage(slot)));
+        m_Pool.Kill(slot);
+    }
+}
+
+void ProjectileSystem::update(World &world, float dt)
+{
+    // PASO 1: Disparar
+    fire(world, dt);
+
+    // PASO 2: Integrar + expirar (una pasada por lote)
+    m_Pool.Integrate(dt, m_WorldWidth, m_WorldHeight);
+
+    // PASO 3: Impactos contra enemigos
+    resolveHits(world);
+}
+
+void ProjectileSystem::Capture(RenderSnapshot &snapshot) const
+{
+    snapshot.projectileWidth = m_Config.width;
+    snapshot.projectileHeight = m_Config.height;
+
+    // Culling contra la vista en ambos ticks (ampliada medio proyectil: se comparan centros)
+    const bool cull = snapshot.camera.IsActive();
+    const SDL_FRect view = snapshot.camera.SweptBounds(std::max(m_Config.width, m_Config.height));
+
+    // Vector del snapshot reutilizado entre frames: sin allocation en régimen estable
+    const uint32_t count = m_Pool.GetHighWater();
+    for (uint32_t slot = 0; slot < count; ++slot)
+    {
+        if (!m_Pool.IsAlive(slot))
+            continue;
+
+        if (cull)
+        {
+            float x = m_Pool.GetX(slot), y = m_Pool.GetY(slot);
+            float px = m_Pool.GetPreviousX(slot), py = m_Pool.GetPreviousY(slot);
+            bool inside = (x >= view.x && x <= view.x + view.w && y >= view.y && y <= view.y + view.h) ||
+                          (px >= view.x && px <= view.x + view.w && py >= view.y && py <= view.y + view.h);
+            if (!inside)
+                continue;
+        }
+
+        snapshot.projectiles.push_back(ProjectileDraw{m_Pool.GetPreviousX(slot), m_Pool.GetPreviousY(slot),
+                                                      m_Pool.GetX(slot), m_Pool.GetY(slot)});
+    }
+}
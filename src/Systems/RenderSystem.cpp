@@ -5,13 +5,46 @@
 #include "../../include/Components/SpriteComponent.h"
 #include "../../include/Components/ColliderComponent.h"
 #include "../../include/Components/PlayerComponent.h"
+#include "../../include/Components/CameraComponent.h"
 #include <spdlog/spdlog.h>
+#include <glm/glm.hpp>
 #include <sstream>
 #include <iomanip>
 #include <cmath>
 
+namespace
+{
+    SDL_FRect ToRect(const glm::vec2 &position, const glm::vec2 &size)
+    {
+        return SDL_FRect{position.x, position.y, size.x, size.y};
+    }
+
+    SDL_FRect MixRect(const SDL_FRect &previous, const SDL_FRect &current, float alpha)
+    {
+        return SDL_FRect{previous.x + (current.x - previous.x) * alpha,
+                         previous.y + (current.y - previous.y) * alpha,
+                         current.w, current.h};
+    }
+
+    bool Overlaps(const SDL_FRect &a, const SDL_FRect &b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+
+    // Visible con algún alpha: el sprite entre su rectángulo anterior y el actual toca la vista
+    bool SweptOverlaps(const SDL_FRect &previous, const SDL_FRect &current, const SDL_FRect &view)
+    {
+        return Overlaps(previous, view) || Overlaps(current, view);
+    }
+
+    // Margen del culling: cubre el movimiento sin interpolar de un tick (sin huecos en los bordes)
+    const float CULL_MARGIN = 64.0f;
+}
+
 RenderSystem::RenderSystem(const GameContext &ctx)
-    : m_Renderer(ctx.renderer), m_ElapsedTime(0.0f)
+    : m_Renderer(ctx.renderer), m_Assets(ctx.assets), m_Batch(ctx.batch), m_WorldWidth(ctx.worldWidth), m_WorldHeight(ctx.worldHeight),
+      m_ViewWidth(ctx.viewWidth), m_ViewHeight(ctx.viewHeight),
+      m_ElapsedTime(0.0f), m_Snapshot(nullptr), m_StaticLayer(ctx.renderer), m_CacheLayers(true)
 {
 }
 
@@ -27,11 +60,17 @@ float RenderSystem::getElapsedTime() const
 
 void RenderSystem::update(World &world, float dt)
 {
-    if (!m_Renderer)
+    m_ElapsedTime += dt;
+
+    if (!m_Snapshot)
         return;
 
-    m_ElapsedTime += dt;
+    RenderSnapshot &snapshot = *m_Snapshot;
+    snapshot.elapsedTime = m_ElapsedTime;
 
+    // ========================================
+    // JUGADOR (con estado de parpadeo)
+    // ========================================
     Entity *player = world.GetPlayer();
     if (player)
     {
@@ -42,28 +81,44 @@ void RenderSystem::update(World &world, float dt)
 
         if (transform && sprite && collider)
         {
-            float width = collider->m_Bounds.x;
-            float height = collider->m_Bounds.y;
-            SDL_FRect dstRect{transform->m_Position.x, transform->m_Position.y, width, height};
-
             // Si el jugador está invulnerable, aplicar efecto de parpadeo visual
+            // Parpadeo: alternar visibilidad cada flashInterval segundos
+            bool flashHidden = false;
             if (playerComp && playerComp->isFlashing)
             {
-                // Parpadeo: alternar visibilidad cada 0.1 segundos
                 int flashCount = static_cast<int>(playerComp->flashDuration / playerComp->flashInterval);
-                if (flashCount % 2 == 0)
-                {
-                    SDL_RenderTexture(m_Renderer, sprite->m_Texture, nullptr, &dstRect);
-                }
-            }
-            else
-            {
-                SDL_RenderTexture(m_Renderer, sprite->m_Texture, nullptr, &dstRect);
+                flashHidden = (flashCount % 2 != 0);
             }
+
+            snapshot.sprites.push_back(SpriteDraw{sprite->m_Texture.Get(),
+                                                  ToRect(transform->m_PreviousPosition, collider->m_Bounds),
+                                                  ToRect(transform->m_Position, collider->m_Bounds),
+                                                  sprite->m_Layer, flashHidden});
+        }
+
+        // ========================================
+        // CÁMARA (sigue al jugador; define qué se captura)
+        // ========================================
+        auto *camera = player->GetComponent<CameraComponent>();
+        if (camera && transform && collider)
+        {
+            const glm::vec2 halfSize = collider->m_Bounds * 0.5f;
+            camera->Follow(transform->m_PreviousPosition + halfSize, transform->m_Position + halfSize,
+                           m_WorldWidth, m_WorldHeight);
+
+            snapshot.camera = CameraView{camera->m_PreviousPosition.x, camera->m_PreviousPosition.y,
+                                         camera->m_Position.x, camera->m_Position.y,
+                                         camera->m_ViewSize.x, camera->m_ViewSize.y};
         }
     }
 
-    // Dibujar enemigos
+    // Sin cámara la vista es el mundo entero: no se descarta nada
+    const bool cull = snapshot.camera.IsActive();
+    const SDL_FRect view = snapshot.camera.SweptBounds(CULL_MARGIN);
+
+    // ========================================
+    // ENEMIGOS
+    // ========================================
     const auto &enemies = world.GetEnemies();
     for (const auto &enemy : enemies)
     {
@@ -73,15 +128,22 @@ void RenderSystem::update(World &world, float dt)
 
         if (transform && sprite && collider)
         {
-            float width = collider->m_Bounds.x;
-            float height = collider->m_Bounds.y;
-            SDL_FRect dstRect{transform->m_Position.x, transform->m_Position.y, width, height};
-            SDL_RenderTexture(m_Renderer, sprite->m_Texture, nullptr, &dstRect);
+            SDL_FRect previous = ToRect(transform->m_PreviousPosition, collider->m_Bounds);
+            SDL_FRect current = ToRect(transform->m_Position, collider->m_Bounds);
+
+            // Culling: fuera de la vista no genera SpriteDraw ni comando de dibujo
+            if (cull && !SweptOverlaps(previous, current, view))
+                continue;
+
+            snapshot.sprites.push_back(SpriteDraw{sprite->m_Texture.Get(), previous, current, sprite->m_Layer, false});
         }
     }
 
-    // Dibujar obstáculos (cuando existan)
+    // ========================================
+    // OBSTÁCULOS (estáticos: sin interpolación)
+    // ========================================
     const auto &obstacles = world.GetObstacles();
+    snapshot.staticVersion = world.GetObstacleVersion();
 
     for (const auto &obstacle : obstacles)
     {
@@ -91,12 +153,15 @@ void RenderSystem::update(World &world, float dt)
 
         if (transform && sprite && collider)
         {
-            if (sprite->m_Texture)
+            if (sprite->m_Texture.IsValid())
             {
-                float width = collider->m_Bounds.x;
-                float height = collider->m_Bounds.y;
-                SDL_FRect dstRect{transform->m_Position.x, transform->m_Position.y, width, height};
-                SDL_RenderTexture(m_Renderer, sprite->m_Texture, nullptr, &dstRect);
+                // Bajo las entidades: van a la capa cacheada (completa: sin culling);
+                // en WORLD se ordenan con el resto y se descartan fuera de la vista
+                SDL_FRect rect = ToRect(transform->m_Position, collider->m_Bounds);
+                if (sprite->m_Layer <= RenderLayer::GROUND)
+                    snapshot.staticSprites.push_back(SpriteDraw{sprite->m_Texture.Get(), rect, rect, sprite->m_Layer, false});
+                else if (!cull || Overlaps(rect, view))
+                    snapshot.sprites.push_back(SpriteDraw{sprite->m_Texture.Get(), rect, rect, sprite->m_Layer, false});
                 // Logging removido para evitar spam en cada frame
             }
             else
@@ -111,3 +176,147 @@ void RenderSystem::update(World &world, float dt)
         }
     }
 }
+
+void RenderSystem::Draw(const RenderSnapshot &snapshot, float alpha)
+{
+    if (!m_Renderer || !m_Assets || !m_Batch)
+        return;
+
+    m_Queue.Clear();
+
+    // ========================================
+    // VISTA (cámara interpolada, en píxeles enteros: la capa cacheada no se emborrona)
+    // ========================================
+    SDL_FRect view{0.0f, 0.0f, m_ViewWidth, m_ViewHeight};
+    const CameraView &camera = snapshot.camera;
+    if (camera.IsActive())
+    {
+        view = SDL_FRect{std::round(camera.previousX + (camera.x - camera.previousX) * alpha),
+                         std::round(camera.previousY + (camera.y - camera.previousY) * alpha),
+                         camera.width, camera.height};
+    }
+
+    // ========================================
+    // FONDO + OBSTÁCULOS (capa estática)
+    // ========================================
+    DrawStaticLayer(snapshot, view);
+
+    // ========================================
+    // SPRITES (capa de la entidad; WORLD con orden Y)
+    // ========================================
+    ResolveSprites(snapshot.sprites);
+    for (size_t i = 0; i < snapshot.sprites.size(); ++i)
+    {
+        const SpriteDraw &sprite = snapshot.sprites[i];
+        if (sprite.flashHidden)
+            continue;
+
+        // Sprites de atlas: página compartida + rectángulo (misma textura en la clave)
+        const TextureRegion &region = m_Regions[i];
+        if (!region.texture)
+            continue;
+
+        SDL_FRect dstRect = MixRect(sprite.previous, sprite.current, alpha);
+        uint32_t depth = sprite.layer == RenderLayer::WORLD ? DrawQueue::DepthFromY(dstRect.y + dstRect.h) : 0;
+        dstRect.x -= view.x;
+        dstRect.y -= view.y;
+        m_Queue.PushSprite(static_cast<uint8_t>(sprite.layer), depth, region.texture, region.Source(), dstRect);
+    }
+
+    // ========================================
+    // PROYECTILES (quads de color sólido: un lote)
+    // ========================================
+    const SDL_FColor projectileColor{1.0f, 220.0f / 255.0f, 60.0f / 255.0f, 1.0f};
+    const float halfW = snapshot.projectileWidth * 0.5f;
+    const float halfH = snapshot.projectileHeight * 0.5f;
+
+    for (const ProjectileDraw &projectile : snapshot.projectiles)
+    {
+        float x = projectile.previousX + (projectile.x - projectile.previousX) * alpha;
+        float y = projectile.previousY + (projectile.y - projectile.previousY) * alpha;
+        m_Queue.PushRect(static_cast<uint8_t>(RenderLayer::PROJECTILES), 0,
+                         SDL_FRect{x - halfW - view.x, y - halfH - view.y, snapshot.projectileWidth,
+                                   snapshot.projectileHeight},
+                         projectileColor);
+    }
+
+    // ========================================
+    // ORDENAR Y ENVIAR (capa → profundidad → textura)
+    // ========================================
+    m_Queue.Sort();
+    m_Queue.Submit(*m_Batch);
+}
+
+bool RenderSystem::StaticTexturesReady(const RenderSnapshot &snapshot) const
+{
+    if (!m_Assets->IsDone(snapshot.background))
+        return false;
+
+    for (const SpriteDraw &sprite : snapshot.staticSprites)
+    {
+        if (!m_Assets->IsDone(sprite.texture))
+            return false;
+    }
+    return true;
+}
+
+void RenderSystem::DrawStaticLayer(const RenderSnapshot &snapshot, const SDL_FRect &view)
+{
+    const SDL_FRect worldRect{0.0f, 0.0f, m_WorldWidth, m_WorldHeight};
+    const uint64_t key = (static_cast<uint64_t>(snapshot.background.id) << 32) | snapshot.staticVersion;
+
+    // Regenerar solo si cambió el fondo o el conjunto de obstáculos (y ya no hay placeholders)
+    if (m_CacheLayers && !m_StaticLayer.IsValid(key) && StaticTexturesReady(snapshot) &&
+        m_StaticLayer.Begin(*m_Batch, static_cast<int>(m_WorldWidth), static_cast<int>(m_WorldHeight)))
+    {
+        if (SDL_Texture *background = m_Assets->Resolve(snapshot.background))
+            m_Batch->AddSprite(background, nullptr, worldRect);
+
+        ResolveSprites(snapshot.staticSprites);
+        for (size_t i = 0; i < snapshot.staticSprites.size(); ++i)
+            m_Batch->AddSprite(m_Regions[i].texture, m_Regions[i].Source(), snapshot.staticSprites[i].current);
+
+        m_StaticLayer.End(*m_Batch, key);
+        spdlog::info("RenderSystem: capa estática regenerada ({} obstáculos)", snapshot.staticSprites.size());
+    }
+
+    if (m_CacheLayers && m_StaticLayer.IsValid(key))
+    {
+        // Solo la parte del mundo dentro de la vista (origen = rectángulo visible de la capa)
+        SDL_FRect visible;
+        if (SDL_GetRectIntersectionFloat(&view, &worldRect, &visible))
+        {
+            SDL_FRect dst{visible.x - view.x, visible.y - view.y, visible.w, visible.h};
+            m_Queue.PushSprite(static_cast<uint8_t>(RenderLayer::BACKGROUND), 0, m_StaticLayer.GetTexture(), &visible,
+                               dst);
+        }
+        return;
+    }
+
+    // Sin caché (desactivada, texturas pendientes o sin render targets): un comando por quad visible
+    if (SDL_Texture *background = m_Assets->Resolve(snapshot.background))
+    {
+        SDL_FRect dst{-view.x, -view.y, m_WorldWidth, m_WorldHeight};
+        m_Queue.PushSprite(static_cast<uint8_t>(RenderLayer::BACKGROUND), 0, background, nullptr, dst);
+    }
+
+    ResolveSprites(snapshot.staticSprites);
+    for (size_t i = 0; i < snapshot.staticSprites.size(); ++i)
+    {
+        const SpriteDraw &sprite = snapshot.staticSprites[i];
+        if (!Overlaps(sprite.current, view))
+            continue;
+
+        const TextureRegion &region = m_Regions[i];
+        SDL_FRect dst{sprite.current.x - view.x, sprite.current.y - view.y, sprite.current.w, sprite.current.h};
+        m_Queue.PushSprite(static_cast<uint8_t>(sprite.layer), 0, region.texture, region.Source(), dst);
+    }
+}
+
+void RenderSystem::ResolveSprites(const std::vector<SpriteDraw> &sprites)
+{
+    m_Handles.clear();
+    for (const SpriteDraw &sprite : sprites)
+        m_Handles.push_back(sprite.texture);
+    m_Assets->ResolveRegions(m_Handles, m_Regions);
+}
@@ -4,9 +4,9 @@
 #include <spdlog/spdlog.h>
 #include <queue>
 
-SpawnSystem::SpawnSystem(SDL_Renderer *renderer, float worldWidth, float worldHeight,
+SpawnSystem::SpawnSystem(AssetLoader *assets, float worldWidth, float worldHeight,
                          const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes)
-    : m_Renderer(renderer),
+    : m_Assets(assets),
       m_WorldWidth(worldWidth),
       m_WorldHeight(worldHeight),
       m_EnemyTypes(enemyTypes)
@@ -26,9 +26,11 @@ void SpawnSystem::update(World &world, float dt)
             auto *spawnEvent = static_cast<SpawnEnemyEvent *>(event.get());
             EntityManager::CreateEnemy(
                 world,
-                m_Renderer,
+                *m_Assets,
                 m_EnemyTypes,
                 spawnEvent->enemyTypeName,
+                m_WorldWidth,
+                m_WorldHeight,
                 spawnEvent->speedMultiplier);
         }
         else if (event->getType() == "ObstacleSpawnEvent")
@@ -37,7 +39,7 @@ void SpawnSystem::update(World &world, float dt)
             auto *obstacleEvent = static_cast<ObstacleSpawnEvent *>(event.get());
             EntityManager::CreateObstacle(
                 world,
-                m_Renderer,
+                *m_Assets,
                 m_ObstacleConfig,
                 obstacleEvent->x,
                 obstacleEvent->y);
@@ -11,8 +11,8 @@ WaveManagerSystem::WaveManagerSystem(const GameContext &ctx,
     spdlog::info("WaveManagerSystem: Inicializando subsistemas...");
 
     // Crear subsistemas en orden de dependencia
-    m_WaveSystem = std::make_unique<WaveSystem>(ctx.renderer, ctx.worldWidth, ctx.worldHeight, enemyTypes);
-    m_SpawnSystem = std::make_unique<SpawnSystem>(ctx.renderer, ctx.worldWidth, ctx.worldHeight, enemyTypes);
+    m_WaveSystem = std::make_unique<WaveSystem>(ctx.assets, ctx.worldWidth, ctx.worldHeight, enemyTypes);
+    m_SpawnSystem = std::make_unique<SpawnSystem>(ctx.assets, ctx.worldWidth, ctx.worldHeight, enemyTypes);
     m_LifetimeSystem = std::make_unique<LifetimeSystem>();
 
     spdlog::info("WaveManagerSystem: Todos los subsistemas inicializados correctamente");
@@ -49,13 +49,9 @@ void WaveManagerSystem::update(World &world, float dt)
     }
 }
 
-void WaveManagerSystem::render(World &world)
+TextureHandle WaveManagerSystem::GetBackgroundTexture() const
 {
-    // ✅ FASE DE RENDER: Solo renderizar fondos
-    if (m_WaveSystem)
-    {
-        m_WaveSystem->renderBackground();
-    }
+    return m_WaveSystem ? m_WaveSystem->GetBackgroundTexture() : TextureHandle();
 }
 
 bool WaveManagerSystem::LoadWavesConfig(const std::vector<ConfigLoader::WaveConfig> &waves)
@@ -76,6 +72,11 @@ void WaveManagerSystem::LoadObstacleConfig(const ConfigLoader::ObstacleConfig &o
         return;
     }
     m_SpawnSystem->SetObstacleConfig(obstacle);
+
+    if (m_WaveSystem)
+    {
+        m_WaveSystem->SetObstacleConfig(obstacle);
+    }
 }
 
 void WaveManagerSystem::LoadObstaclesByPhase(const ConfigLoader::ObstaclesByPhaseData &obstacles)
@@ -88,6 +89,16 @@ void WaveManagerSystem::LoadObstaclesByPhase(const ConfigLoader::ObstaclesByPhas
     m_WaveSystem->LoadObstaclesByPhase(obstacles);
 }
 
+void WaveManagerSystem::SetPrefetchLeadTime(float seconds)
+{
+    if (!m_WaveSystem)
+    {
+        spdlog::error("WaveManagerSystem: WaveSystem no inicializado");
+        return;
+    }
+    m_WaveSystem->SetPrefetchLeadTime(seconds);
+}
+
 void WaveManagerSystem::StartWaves(World &world)
 {
     if (!m_WaveSystem)
@@ -5,24 +5,20 @@
 #include <spdlog/spdlog.h>
 #include <glm/glm.hpp>
 
-WaveSystem::WaveSystem(SDL_Renderer *renderer, float screenWidth, float screenHeight,
-                       const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes)
-    : m_Renderer(renderer), m_ScreenWidth(screenWidth), m_ScreenHeight(screenHeight),
-      m_EnemyTypes(enemyTypes),
-      m_CurrentWave(0), m_WaveTimer(0.0f), m_SpawnTimer(0.0f),
-      m_EnemiesSpawnedInWave(0), m_WaveInProgress(false), m_WaveEnded(false),
-      m_CurrentBackgroundTexture(nullptr)
+namespace
 {
+    constexpr float OBSTACLE_FIELD_CELL_SIZE = 16.0f; // Separación entre nodos del SDF (píxeles)
 }
 
-WaveSystem::~WaveSystem()
+WaveSystem::WaveSystem(AssetLoader *assets, float worldWidth, float worldHeight,
+                       const std::vector<ConfigLoader::EnemyTypeConfig> &enemyTypes)
+    : m_EnemyTypes(enemyTypes),
+      m_ObstacleConfig{"", 0.0f, 0.0f},
+      m_CurrentWave(0), m_WaveTimer(0.0f), m_SpawnTimer(0.0f),
+      m_EnemiesSpawnedInWave(0), m_WaveInProgress(false), m_WaveEnded(false),
+      m_PrefetchLeadTime(5.0f), m_PrefetchedWave(-1),
+      m_Assets(assets), m_WorldWidth(worldWidth), m_WorldHeight(worldHeight)
 {
-    // Liberar textura de fondo
-    if (m_CurrentBackgroundTexture)
-    {
-        SDL_DestroyTexture(m_CurrentBackgroundTexture);
-        m_CurrentBackgroundTexture = nullptr;
-    }
 }
 
 bool WaveSystem::LoadWavesConfig(const std::vector<ConfigLoader::WaveConfig> &waves)
@@ -58,37 +54,6 @@ void WaveSystem::LoadObstaclesByPhase(const ConfigLoader::ObstaclesByPhaseData &
     m_ObstaclesByPhase = obstacles;
 }
 
-void WaveSystem::renderBackground()
-{
-    if (!m_Renderer || m_Waves.empty() || m_CurrentWave >= m_Waves.size())
-        return;
-
-    const auto &currentWave = m_Waves[m_CurrentWave];
-
-    // Si ya no hay textura cargada o cambió la onda, cargar la nueva
-    if (!m_CurrentBackgroundTexture)
-    {
-        if (!currentWave.imagePath.empty())
-        {
-            m_CurrentBackgroundTexture = IMG_LoadTexture(m_Renderer, currentWave.imagePath.c_str());
-
-            if (!m_CurrentBackgroundTexture)
-            {
-                spdlog::warn("WaveSystem: No se pudo cargar imagen: {}", currentWave.imagePath);
-            }
-        }
-    }
-
-    // Renderizar la textura
-    if (m_CurrentBackgroundTexture)
-    {
-        SDL_FRect bgRect{0.0f, 0.0f,
-                         static_cast<float>(m_ScreenWidth),
-                         static_cast<float>(m_ScreenHeight)};
-        SDL_RenderTexture(m_Renderer, m_CurrentBackgroundTexture, nullptr, &bgRect);
-    }
-}
-
 void WaveSystem::StartWave(World &world)
 {
     if (m_CurrentWave >= m_Waves.size())
@@ -104,18 +69,24 @@ void WaveSystem::StartWave(World &world)
 
     const auto &currentWave = m_Waves[m_CurrentWave];
 
-    // ✅ Descargar textura anterior y cargar la nueva
-    if (m_CurrentBackgroundTexture)
+    // ✅ Fondo de la oleada: normalmente ya precargado durante la anterior
+    // (si no, se decodifica ahora y el render dibuja el placeholder mientras tanto)
+    PrefetchWave(m_CurrentWave);
+
+    // La referencia al fondo anterior se suelta aquí (puede liberarse si hay periodo de gracia)
+    m_CurrentBackground = TextureRef();
+    if (m_Assets && !currentWave.imagePath.empty())
     {
-        SDL_DestroyTexture(m_CurrentBackgroundTexture);
-        m_CurrentBackgroundTexture = nullptr;
+        m_CurrentBackground = m_Assets->Acquire(currentWave.imagePath);
     }
 
-    // La textura se cargará en renderBackground() cuando sea necesario
+    // Ya hay referencia propia: la de la precarga sobra
+    m_PrefetchedBackground = TextureRef();
 
     spdlog::info("=== OLA {} INICIADA ===", m_CurrentWave + 1);
 
     // ✅ Emitir ObstacleSpawnEvent para TODOS los obstáculos de la fase actual, al mismo tiempo
+    std::vector<glm::vec4> obstacleRects;
     if (m_CurrentWave < m_ObstaclesByPhase.phases.size())
     {
         const auto &phaseObstacles = m_ObstaclesByPhase.phases[m_CurrentWave];
@@ -123,14 +94,21 @@ void WaveSystem::StartWave(World &world)
         {
             auto obstacleEvent = std::make_unique<ObstacleSpawnEvent>(obstaclePos.x, obstaclePos.y);
             world.emit(std::move(obstacleEvent));
+
+            obstacleRects.emplace_back(obstaclePos.x, obstaclePos.y,
+                                       m_ObstacleConfig.colliderWidth, m_ObstacleConfig.colliderHeight);
         }
     }
+
+    // ✅ SDF de la fase: las posiciones ya se conocen, no hace falta esperar a las entidades
+    world.GetObstacleField().Build(m_WorldWidth, m_WorldHeight, OBSTACLE_FIELD_CELL_SIZE, obstacleRects);
 }
 
 void WaveSystem::EndWave(World &world)
 {
     m_WaveInProgress = false;
     m_WaveEnded = true; // ✅ Marcar que la oleada terminó para procesar en el siguiente frame
+    world.GetObstacleField().Clear(); // LifetimeSystem elimina los obstáculos con el WaveEndEvent
     spdlog::info("=== OLA {} FINALIZADA ===", m_CurrentWave + 1);
 
     // EMIT WaveEndEvent para que otros sistemas reaccionen (matar enemigos)
@@ -157,6 +135,24 @@ void WaveSystem::NextWave(World &world)
     }
 }
 
+void WaveSystem::PrefetchWave(int waveIndex)
+{
+    if (!m_Assets || waveIndex < 0 || waveIndex >= static_cast<int>(m_Waves.size()) ||
+        waveIndex <= m_PrefetchedWave)
+        return;
+
+    m_PrefetchedWave = waveIndex;
+    const auto &wave = m_Waves[waveIndex];
+
+    // Solo el fondo: los sprites de enemigos y obstáculos ya están en el atlas.
+    // Se guarda la referencia para que el periodo de gracia no lo libere antes de StartWave
+    if (!wave.imagePath.empty())
+    {
+        m_PrefetchedBackground = m_Assets->Acquire(wave.imagePath);
+        spdlog::info("WaveSystem: Precarga del fondo de la ola {}", waveIndex + 1);
+    }
+}
+
 void WaveSystem::update(World &world, float dt)
 {
     // ✅ PRIMERO: Procesar si la oleada anterior fue marcada como terminada
@@ -212,6 +208,12 @@ void WaveSystem::update(World &world, float dt)
         m_SpawnTimer = 0.0f;
     }
 
+    // ✅ Precargar la siguiente ola con prefetchLeadTime segundos de antelación
+    if (currentWave.duration - m_WaveTimer <= m_PrefetchLeadTime)
+    {
+        PrefetchWave(m_CurrentWave + 1);
+    }
+
     // Verificar si la ola ha terminado (tiempo excedido)
     if (m_WaveTimer >= currentWave.duration)
     {
@@ -0,0 +1,140 @@
+#include "TimingWheel.h"
+#include <algorithm>
+
+TimingWheel::TimingWheel()
+    : m_FreeHead(NIL), m_Now(0), m_Pending(0)
+{
+    for (int level = 0; level < LEVELS; ++level)
+        std::fill(m_Slots[level], m_Slots[level] + SLOTS, NIL);
+}
+
+TimerHandle TimingWheel::Schedule(uint64_t delayTicks, uint32_t entityId, uint32_t tag)
+{
+    // Limitar al rango de la rueda (64^4 - 1 ticks)
+    const uint64_t maxDelay = (uint64_t(1) << (SLOT_BITS * LEVELS)) - 1;
+    delayTicks = std::clamp<uint64_t>(delayTicks, 1, maxDelay);
+
+    uint32_t index;
+    if (m_FreeHead != NIL)
+    {
+        index = m_FreeHead;
+        m_FreeHead = m_Entries[index].next;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(m_Entries.size());
+        m_Entries.push_back(Entry{0, 0, 0, NIL, 0, false});
+    }
+
+    Entry &entry = m_Entries[index];
+    entry.deadline = m_Now + delayTicks;
+    entry.entityId = entityId;
+    entry.tag = tag;
+    entry.cancelled = false;
+
+    Insert(index);
+    ++m_Pending;
+    return TimerHandle{index, entry.generation};
+}
+
+void TimingWheel::Cancel(TimerHandle handle)
+{
+    if (handle.index >= m_Entries.size())
+        return;
+
+    Entry &entry = m_Entries[handle.index];
+    if (entry.generation != handle.generation || entry.cancelled)
+        return;
+
+    // Borrado perezoso: la entrada sigue enlazada hasta que su ranura se procese
+    entry.cancelled = true;
+    --m_Pending;
+}
+
+void TimingWheel::Clear()
+{
+    for (int level = 0; level < LEVELS; ++level)
+        std::fill(m_Slots[level], m_Slots[level] + SLOTS, NIL);
+
+    // Todas las entradas vuelven a la free list con nueva generación
+    m_FreeHead = NIL;
+    for (uint32_t index = static_cast<uint32_t>(m_Entries.size()); index-- > 0;)
+        Release(index);
+
+    m_Now = 0;
+    m_Pending = 0;
+}
+
+void TimingWheel::Insert(uint32_t index)
+{
+    Entry &entry = m_Entries[index];
+    const uint64_t delta = entry.deadline - m_Now;
+
+    // Nivel más bajo cuyo rango cubre el plazo restante
+    int level = 0;
+    while (level < LEVELS - 1 && delta >= (uint64_t(1) << (SLOT_BITS * (level + 1))))
+        ++level;
+
+    const uint32_t slot = static_cast<uint32_t>(entry.deadline >> (SLOT_BITS * level)) & SLOT_MASK;
+    entry.next = m_Slots[level][slot];
+    m_Slots[level][slot] = index;
+}
+
+void TimingWheel::Release(uint32_t index)
+{
+    Entry &entry = m_Entries[index];
+    ++entry.generation;
+    entry.next = m_FreeHead;
+    m_FreeHead = index;
+}
+
+void TimingWheel::Cascade(int level)
+{
+    const uint32_t slot = static_cast<uint32_t>(m_Now >> (SLOT_BITS * level)) & SLOT_MASK;
+    uint32_t index = m_Slots[level][slot];
+    m_Slots[level][slot] = NIL;
+
+    while (index != NIL)
+    {
+        const uint32_t next = m_Entries[index].next;
+        if (m_Entries[index].cancelled)
+            Release(index);
+        else
+            Insert(index); // Plazo restante < 64^level: cae en un nivel inferior
+        index = next;
+    }
+}
+
+void TimingWheel::Advance(uint64_t ticks, std::vector<Expiration> &out)
+{
+    for (uint64_t t = 0; t < ticks; ++t)
+    {
+        ++m_Now;
+
+        // Cascada: al dar la vuelta un nivel, bajar la ranura actual del siguiente
+        for (int level = 1; level < LEVELS; ++level)
+        {
+            if ((m_Now & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) != 0)
+                break;
+            Cascade(level);
+        }
+
+        // Disparar la ranura del tick actual (todas sus entradas vencen ahora)
+        const uint32_t slot = static_cast<uint32_t>(m_Now) & SLOT_MASK;
+        uint32_t index = m_Slots[0][slot];
+        m_Slots[0][slot] = NIL;
+
+        while (index != NIL)
+        {
+            Entry &entry = m_Entries[index];
+            const uint32_t next = entry.next;
+            if (!entry.cancelled)
+            {
+                out.push_back(Expiration{entry.entityId, entry.tag});
+                --m_Pending;
+            }
+            Release(index);
+            index = next;
+        }
+    }
+}
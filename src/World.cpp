@@ -4,6 +4,7 @@
 #include "Components/EnemyComponent.h"
 #include "Components/ObstacleComponent.h"
 #include <algorithm>
+#include <cmath>
 #include <spdlog/spdlog.h>
 
 World::World() = default;
@@ -40,6 +41,131 @@ void World::deleteEntity(uint32_t id)
     }
 }
 
+void World::Clear()
+{
+    m_Entities.clear();
+    m_EntityMap.clear();
+    m_CacheDirty = true;
+    while (!m_EventQueue.empty())
+        m_EventQueue.pop();
+
+    // Temporizadores y SDF se refieren a entidades/fase que ya no existen
+    m_Timers.Clear();
+    m_TimerAccumulator = 0.0f;
+    m_ObstacleField.Clear();
+}
+
+// ========================================
+// TEMPORIZADORES
+// ========================================
+void World::SetTimerResolution(float tickSeconds)
+{
+    m_TimerTickSeconds = std::max(1e-4f, tickSeconds);
+}
+
+TimerHandle World::ScheduleTimer(float delaySeconds, uint32_t entityId, TimerTag tag)
+{
+    // Redondear hacia arriba (con tolerancia para delays múltiplos exactos del tick)
+    float ticks = std::ceil(delaySeconds / m_TimerTickSeconds - 1e-3f);
+    uint64_t delayTicks = ticks > 1.0f ? static_cast<uint64_t>(ticks) : 1;
+    return m_Timers.Schedule(delayTicks, entityId, static_cast<uint32_t>(tag));
+}
+
+void World::CancelTimer(TimerHandle handle)
+{
+    m_Timers.Cancel(handle);
+}
+
+void World::AdvanceTimers(float dt)
+{
+    m_TimerAccumulator += dt;
+    uint64_t ticks = static_cast<uint64_t>(m_TimerAccumulator / m_TimerTickSeconds);
+    if (ticks == 0)
+        return;
+    m_TimerAccumulator -= ticks * m_TimerTickSeconds;
+
+    m_ExpiredTimers.clear();
+    m_Timers.Advance(ticks, m_ExpiredTimers);
+
+    for (const auto &expired : m_ExpiredTimers)
+        emit(std::make_unique<TimerEvent>(expired.entityId, static_cast<TimerTag>(expired.tag)));
+}
+
+// ========================================
+// INPUT
+// ========================================
+void World::SetKeyboardState(const bool *keys, size_t count)
+{
+    count = std::min<size_t>(count, SDL_SCANCODE_COUNT);
+    std::copy(keys, keys + count, m_KeyboardState);
+    std::fill(m_KeyboardState + count, m_KeyboardState + SDL_SCANCODE_COUNT, false);
+    std::copy(m_KeyboardState, m_KeyboardState + SDL_SCANCODE_COUNT, m_KeyboardTickStart);
+    m_TickInput.clear();
+}
+
+void World::BeginInputTick(Uint64 startNs, Uint64 endNs, const std::vector<InputEvent> &events)
+{
+    m_TickStartNs = startNs;
+    m_TickEndNs = std::max(startNs, endNs);
+    std::copy(m_KeyboardState, m_KeyboardState + SDL_SCANCODE_COUNT, m_KeyboardTickStart);
+
+    m_TickInput.clear();
+    for (InputEvent event : events)
+    {
+        if (event.scancode <= SDL_SCANCODE_UNKNOWN || event.scancode >= SDL_SCANCODE_COUNT)
+            continue;
+
+        event.timestampNs = std::clamp(event.timestampNs, m_TickStartNs, m_TickEndNs);
+        m_KeyboardState[event.scancode] = event.down;
+        m_TickInput.push_back(event);
+    }
+}
+
+float World::GetKeyHeldFraction(SDL_Scancode scancode) const
+{
+    if (scancode <= SDL_SCANCODE_UNKNOWN || scancode >= SDL_SCANCODE_COUNT)
+        return 0.0f;
+
+    // Tick sin duración (SetKeyboardState): estado final
+    if (m_TickEndNs <= m_TickStartNs)
+        return m_KeyboardState[scancode] ? 1.0f : 0.0f;
+
+    // Recorrer las transiciones de esta tecla sumando los intervalos pulsada
+    bool down = m_KeyboardTickStart[scancode];
+    Uint64 since = m_TickStartNs;
+    Uint64 held = 0;
+    for (const InputEvent &event : m_TickInput)
+    {
+        if (event.scancode != scancode)
+            continue;
+        if (down)
+            held += event.timestampNs - since;
+        down = event.down;
+        since = event.timestampNs;
+    }
+    if (down)
+        held += m_TickEndNs - since;
+
+    return static_cast<float>(static_cast<double>(held) / (m_TickEndNs - m_TickStartNs));
+}
+
+bool World::WasKeyDown(SDL_Scancode scancode) const
+{
+    if (scancode <= SDL_SCANCODE_UNKNOWN || scancode >= SDL_SCANCODE_COUNT)
+        return false;
+
+    if (m_KeyboardTickStart[scancode] || m_KeyboardState[scancode])
+        return true;
+
+    // Pulsada y soltada dentro del tick
+    for (const InputEvent &event : m_TickInput)
+    {
+        if (event.scancode == scancode && event.down)
+            return true;
+    }
+    return false;
+}
+
 // Emite evento al bus
 void World::emit(std::unique_ptr<Event> event)
 {
@@ -85,6 +211,13 @@ void World::RebuildCacheIfNeeded()
             m_ObstacleEntities.push_back(e);
     }
 
+    // Solo cambia la versión de cada categoría si su conjunto es distinto
+    // (ej: spawnear enemigos no invalida datos derivados de obstáculos)
+    if (SyncIds(m_EnemyEntities, m_EnemyIds))
+        ++m_EnemyVersion;
+    if (SyncIds(m_ObstacleEntities, m_ObstacleIds))
+        ++m_ObstacleVersion;
+
     m_CacheDirty = false;
 }
 
@@ -102,6 +235,36 @@ const std::vector<Entity *> &World::GetObstacles()
     return m_ObstacleEntities;
 }
 
+// Compara IDs del caché con la instantánea anterior
+bool World::SyncIds(const std::vector<Entity *> &cache, std::vector<uint32_t> &ids)
+{
+    bool changed = cache.size() != ids.size();
+    for (size_t i = 0; !changed && i < cache.size(); ++i)
+        changed = cache[i]->m_Id != ids[i];
+
+    if (changed)
+    {
+        ids.clear();
+        for (Entity *e : cache)
+            ids.push_back(e->m_Id);
+    }
+    return changed;
+}
+
+// Obtener versión del conjunto de enemigos
+uint32_t World::GetEnemyVersion()
+{
+    RebuildCacheIfNeeded();
+    return m_EnemyVersion;
+}
+
+// Obtener versión del layout de obstáculos
+uint32_t World::GetObstacleVersion()
+{
+    RebuildCacheIfNeeded();
+    return m_ObstacleVersion;
+}
+
 // Buscar entidad por ID (O(1) - HashMap)
 Entity *World::FindEntityById(uint32_t id) const
 {
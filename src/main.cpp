@@ -1,7 +1,26 @@
 #include "Game.h"
+#include "MatchServer.h"
+#include "SteeringBench.h"
 
-int main()
+int main(int argc, char *argv[])
 {
+    // Benchmark del kernel de persecución: SSE contra la referencia escalar
+    if (SteeringBench::IsBenchmarkMode(argc, argv))
+    {
+        return SteeringBench::Run(argc, argv) ? 0 : -1;
+    }
+
+    // Modo servidor: lote de partidas headless (sin ventana ni renderer)
+    if (MatchServer::IsServerMode(argc, argv))
+    {
+        MatchServer server;
+        if (!server.Initialize(argc, argv))
+        {
+            return -1;
+        }
+        return server.Run() ? 0 : -1;
+    }
+
     Game game;
     if (!game.Initialize())
     {